@@ -0,0 +1,232 @@
+// 📈 Benchmark suite for the graph and tree algorithms in this repository
+// Every program in GRAPH/ and Tree/ demonstrates its algorithm on a 4-6 vertex example.
+// This one runs the SAME code (the shared headers those programs include) on seeded synthetic
+// inputs of growing size and reports, per algorithm and size:
+//   time (best of a few runs), edges per second, and peak resident memory (RSS).
+// Edges per second is always input edges / time, so detectors that stop at the first cycle
+// show huge rates on cyclic inputs: compare rows of the same algorithm across sizes.
+
+// 🧠 Inputs (GRAPH/CORE/generators.h, fixed seeds → every run sees identical graphs)
+// rmat → power-law degrees, small diameter (social / web graphs)
+// grid → degree <= 4, huge diameter (road networks / meshes), directed version is a DAG
+// dag  → random DAG with shuffled ids
+// path → one long chain (deepest DFS, V BFS levels)
+// Trees: random BST shape and fully skewed shape, given as traversals to the two tree builders.
+
+// 🔧 Usage (built by the top-level CMakeLists.txt as benchmark_suite, linked against the same
+// dsa_algorithms library target as every example program)
+//   ./a.out                    → table, graph scales 8, 10, ..., 18
+//   ./a.out --max-scale 20     → go up to 2^20 vertices
+//   ./a.out --json             → one JSON document on stdout (for scripts / plotting)
+//   ./a.out --repeats 5        → best of 5 runs instead of 3
+
+// ⚠️ Quadratic / cubic algorithms are only run where they finish in reasonable time:
+// Bellman-Ford when V * E <= 2e8, Floyd-Warshall when V <= 512.
+// The tree builders recurse once per level, so skewed trees are capped at 2^13 nodes.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <fstream>
+#include <climits>
+#include <cstdlib>
+#include <sys/resource.h>
+#include "../GRAPH/CORE/csr_graph.h"
+#include "../GRAPH/CORE/generators.h"
+#include "../GRAPH/CORE/dfs_engine.h"
+#include "../GRAPH/BFS_DFS/bfs.h"
+#include "../GRAPH/TOPOLOGICAL SORT/kahn.h"
+#include "../GRAPH/TOPOLOGICAL SORT/cycle_bfs.h"
+#include "../GRAPH/SHORTEST_PATH/dijkstra.h"
+#include "../GRAPH/SHORTEST_PATH/bellman_ford.h"
+#include "../GRAPH/SHORTEST_PATH/floyd_warshall.h"
+#include "../Tree/construction/tree_construction.h"
+using namespace std;
+
+struct Result {
+    string input;       // Generator name
+    long long V, E;     // Vertices (tree nodes) and stored edges of the input
+    string algorithm;
+    double ms;          // Best time over the repeats
+    double edgesPerSec; // E / time (for trees: nodes / time)
+    double peakRssMB;   // Peak RSS of the process while the algorithm ran
+};
+
+// Peak RSS: Linux lets us reset the high-water mark (VmHWM) before each algorithm,
+// so the value belongs to that algorithm (input graph included). Elsewhere ru_maxrss is used,
+// which only ever grows over the whole process.
+void resetPeakRss() {
+    ofstream clear("/proc/self/clear_refs");
+    if (clear) clear << "5";
+}
+
+double peakRssMB() {
+    ifstream status("/proc/self/status");
+    string key;
+    while (status >> key) {
+        if (key == "VmHWM:") {
+            long long kb;
+            status >> kb;
+            return kb / 1024.0;
+        }
+        status.ignore(1 << 20, '\n');
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+int repeats = 3;
+vector<Result> results;
+
+// setup() runs before every repeat, outside the timed region (e.g. a fresh input to work in place on)
+template <typename Setup, typename Run>
+void measure(const string& input, long long V, long long E, const string& algorithm, Setup setup, Run run) {
+    double best = 1e18;
+    resetPeakRss();
+    for (int i = 0; i < repeats; i++) {
+        setup();
+        auto start = chrono::steady_clock::now();
+        run();
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    double perSec = best > 0 ? E / (best / 1000.0) : 0;
+    results.push_back({input, V, E, algorithm, best, perSec, peakRssMB()});
+}
+
+template <typename Run>
+void measure(const string& input, long long V, long long E, const string& algorithm, Run run) {
+    measure(input, V, E, algorithm, [] {}, run);
+}
+
+// Keeps results "used" so the optimizer cannot drop the call (volatile: every write happens)
+volatile long long sink = 0;
+
+void benchmarkGraph(const string& name, int V, const vector<Edge>& edges, bool acyclic) {
+    CSRGraph directed = buildCSR(V, edges, true);
+    CSRGraph undirected = buildCSR(V, edges, false);
+    long long dE = directed.numEdges(), uE = undirected.numEdges();
+
+    // Start traversals from the highest-degree vertex (vertex 0 may be isolated in RMAT graphs)
+    int src = 0;
+    for (int v = 1; v < V; v++) {
+        if (undirected.degree(v) > undirected.degree(src)) src = v;
+    }
+
+    measure(name, V, uE, "bfs", [&] { sink += bfsOfGraph(undirected, src).size(); });
+    measure(name, V, uE, "dfs", [&] { sink += dfsOrder(undirected, src).size(); });
+
+    // Topological sorts only mean something on DAGs
+    if (acyclic) {
+        measure(name, V, dE, "topo_dfs", [&] { sink += dfsTopoSort(directed).size(); });
+        measure(name, V, dE, "topo_kahn", [&] { sink += kahnTopoSort(directed).size(); });
+    }
+
+    measure(name, V, dE, "cycle_directed_dfs", [&] { sink += hasDirectedCycle(directed); });
+    measure(name, V, dE, "cycle_directed_kahn", [&] { sink += hasCycleKahn(directed); });
+    measure(name, V, uE, "cycle_undirected_bfs", [&] { sink += hasUndirectedCycleBFS(undirected); });
+    measure(name, V, uE, "cycle_undirected_dfs", [&] { sink += hasUndirectedCycle(undirected); });
+
+    vector<int> dist;
+    measure(name, V, uE, "dijkstra", [&] { dijkstra(src, undirected, dist); sink += dist[src]; });
+
+    if ((double)V * dE <= 2e8) {
+        measure(name, V, dE, "bellman_ford", [&] { sink += bellmanFord(directed, src, dist); });
+    }
+
+    if (V <= 512) {
+        const int INF = 1e9;
+        vector<vector<int>> input(V, vector<int>(V, INF)), matrix;
+        for (int u = 0; u < V; u++) {
+            input[u][u] = 0;
+            for (int i = directed.offsets[u]; i < directed.offsets[u + 1]; i++) {
+                input[u][directed.adj[i]] = min(input[u][directed.adj[i]], directed.weights[i]);
+            }
+        }
+        // The O(V^2) matrix is built once; each repeat gets a fresh copy outside the timer
+        measure(name, V, dE, "floyd_warshall", [&] { matrix = input; },
+                [&] { sink += floydWarshallDistances(matrix, INF); });
+    }
+}
+
+void benchmarkTree(const string& name, int n, bool skewed) {
+    TreeTraversals t = randomTreeTraversals(n, skewed, 7);
+
+    measure(name, n, n, "tree_pre_in", [&] {
+        TreeNode* root = TreeFromPreIn().buildTree(t.preorder, t.inorder);
+        sink += root->val;
+        deleteTree(root);
+    });
+    measure(name, n, n, "tree_post_in", [&] {
+        TreeNode* root = TreeFromPostIn().buildTree(t.inorder, t.postorder);
+        sink += root->val;
+        deleteTree(root);
+    });
+}
+
+void printTable() {
+    cout << left << setw(8) << "input" << right << setw(10) << "V" << setw(11) << "E"
+         << "  " << left << setw(22) << "algorithm" << right << setw(12) << "ms"
+         << setw(14) << "Medges/s" << setw(12) << "peak MB" << endl;
+    cout << fixed << setprecision(2);
+    for (auto& r : results) {
+        cout << left << setw(8) << r.input << right << setw(10) << r.V << setw(11) << r.E
+             << "  " << left << setw(22) << r.algorithm << right << setw(12) << r.ms
+             << setw(14) << r.edgesPerSec / 1e6 << setw(12) << r.peakRssMB << endl;
+    }
+}
+
+void printJson() {
+    cout << "{\n  \"repeats\": " << repeats << ",\n  \"results\": [\n";
+    cout << fixed << setprecision(3);
+    for (size_t i = 0; i < results.size(); i++) {
+        auto& r = results[i];
+        cout << "    {\"input\": \"" << r.input << "\", \"V\": " << r.V << ", \"E\": " << r.E
+             << ", \"algorithm\": \"" << r.algorithm << "\", \"ms\": " << r.ms
+             << ", \"edges_per_sec\": " << r.edgesPerSec << ", \"peak_rss_mb\": " << r.peakRssMB << "}"
+             << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    cout << "  ]\n}" << endl;
+}
+
+int main(int argc, char** argv) {
+    int maxScale = 18;
+    bool json = false;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--json") json = true;
+        else if (arg == "--max-scale" && i + 1 < argc) maxScale = atoi(argv[++i]);
+        else if (arg == "--repeats" && i + 1 < argc) repeats = max(1, atoi(argv[++i]));
+        else {
+            cerr << "Usage: " << argv[0] << " [--max-scale N] [--repeats N] [--json]" << endl;
+            return 1;
+        }
+    }
+
+    for (int scale = 8; scale <= maxScale; scale += 2) {
+        int V = 1 << scale;
+        int side = 1 << (scale / 2);   // side * side = V for even scales
+
+        benchmarkGraph("rmat", V, rmatEdges(scale, 8, 1, 100), false);
+        benchmarkGraph("grid", side * side, gridEdges(side, side, 1, 100), true);
+        benchmarkGraph("dag", V, randomDagEdges(V, 4LL * V, 1, 100), true);
+        benchmarkGraph("path", V, pathEdges(V, 1, 100), true);
+
+        benchmarkTree("tree", V, false);
+        if (scale <= 13) benchmarkTree("skewed", V, true);
+    }
+
+    if (json) printJson();
+    else printTable();
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Sum of the algorithms' own costs over all inputs; dominated by the largest scale
+// (Bellman-Ford / Floyd-Warshall are size-capped so they never dominate).
+
+// 🧠 Space Complexity (SC):
+// One input graph (directed + undirected CSR) at a time plus the algorithm's own memory → O(V + E)
@@ -5,35 +5,12 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
+#include <random>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "bfs.h"   // bfsOfGraph, bfsDirectionOptimizing
 using namespace std;
 
-// Function to perform BFS traversal of the graph
-vector<int> bfsOfGraph(int V, vector<vector<int>>& adj) {
-    vector<int> bfs;         // Stores the BFS traversal result
-    vector<int> vis(V, 0);   // Visited array to keep track of visited nodes
-    queue<int> q;            // Queue for BFS
-
-    vis[0] = 1;              // Start BFS from node 0
-    q.push(0);
-
-    while (!q.empty()) {
-        int node = q.front();
-        q.pop();
-        bfs.push_back(node); // Process current node
-
-        // Visit all adjacent unvisited nodes
-        for (int neighbor : adj[node]) {
-            if (!vis[neighbor]) {
-                vis[neighbor] = 1;   // Mark as visited
-                q.push(neighbor);    // Add to queue for further exploration
-            }
-        }
-    }
-
-    return bfs;
-}
-
 int main() {
     int V = 5; // Number of vertices
 
@@ -45,8 +22,11 @@ int main() {
     adj[3] = {1};
     adj[4] = {2};
 
+    // Build the CSR graph once, it can be shared by any number of queries
+    CSRGraph g = buildCSR(adj);
+
     // Perform BFS
-    vector<int> result = bfsOfGraph(V, adj);
+    vector<int> result = bfsOfGraph(g);
 
     // Output the result
     cout << "BFS Traversal: ";
@@ -55,6 +35,43 @@ int main() {
     }
     cout << endl;
 
+    // Direction-optimizing BFS gives the same levels
+    DOBFSResult dob = bfsDirectionOptimizing(g);
+    cout << "Levels (direction-optimizing): ";
+    for (int node = 0; node < V; node++) {
+        cout << node << ":" << dob.level[node] << " ";
+    }
+    cout << endl;
+
+    // On a bigger random (low-diameter) graph the middle levels switch to bottom-up
+    int n = 1 << 16;
+    mt19937 rng(42);
+    vector<vector<int>> edges;
+    for (int i = 0; i < 8 * n; i++) {
+        int u = rng() % n, v = rng() % n;
+        edges.push_back({u, v});
+    }
+    CSRGraph big = buildCSR(n, edges, false);
+
+    DOBFSResult mixed = bfsDirectionOptimizing(big);
+    DOBFSResult topDown = bfsDirectionOptimizing(big, 0, 0);  // alpha = 0 → pure top-down
+
+    cout << "Level\tDirection\tEdges checked (top-down only)" << endl;
+    for (int d = 0; d < (int)mixed.bottomUp.size(); d++) {
+        cout << d << "\t" << (mixed.bottomUp[d] ? "bottom-up" : "top-down") << "\t"
+             << mixed.edgesChecked[d] << " (" << topDown.edgesChecked[d] << ")" << endl;
+    }
+    cout << "Levels match top-down BFS: " << (mixed.level == topDown.level ? "yes" : "no") << endl;
+
+    // Only the levels (and so the visited set) are guaranteed: within a bottom-up level the nodes
+    // come out in vertex-id order. Pure top-down gives exactly the queue order of bfsOfGraph.
+    vector<int> queueOrder = bfsOfGraph(big);
+    vector<int> sortedMixed = mixed.order, sortedQueue = queueOrder;
+    sort(sortedMixed.begin(), sortedMixed.end());
+    sort(sortedQueue.begin(), sortedQueue.end());
+    cout << "Same visited set as bfsOfGraph: " << (sortedMixed == sortedQueue ? "yes" : "no") << endl;
+    cout << "Top-down order == bfsOfGraph: " << (topDown.order == queueOrder ? "yes" : "no") << endl;
+
     return 0;
 }
 
@@ -67,9 +84,15 @@ int main() {
 // 🧠 Space Complexity (SC):
 // visited array → O(V)
 // queue for BFS → up to O(V) in worst case
-// adj list for graph → O(V + E) for storage
+// adj list / CSR graph → O(V + E) for storage
 // 👉 Total SC: O(V + E)
 
+// ⚡ Direction-optimizing BFS:
+// Worst case still O(V + E) per top-down level and O(V + E) per bottom-up level,
+// but on low-diameter graphs the bottom-up levels stop at the first frontier parent,
+// so the total number of edges checked is usually a small fraction of E.
+// Bitmaps (visited + frontier) → 2 * V bits
+
 
 // 🔥 Common Uses of Graphs
 // 1. Social Networks
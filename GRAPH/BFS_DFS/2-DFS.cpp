@@ -1,6 +1,6 @@
 // ✅ What is DFS?
 // Depth-First Search is a graph traversal technique that goes deep into a branch before backtracking.
-// It uses recursion or an explicit stack.
+// It uses recursion or an explicit stack (here: an explicit stack, see CORE/dfs_engine.h).
 
 // Use Case	Why DFS?
 // File System Traversal	Goes deep into folder structure
@@ -8,29 +8,27 @@
 
 #include <iostream>
 #include <vector>
+#include "../CORE/csr_graph.h"
+#include "../CORE/dfs_engine.h"
 using namespace std;
 
-// Recursive DFS function
-void dfs(int node, vector<vector<int>>& adj, vector<int>& vis, vector<int>& result) {
-    vis[node] = 1;               // Mark current node as visited
-    result.push_back(node);      // Add node to traversal result
-
-    // Visit all unvisited neighbors
-    for (int neighbor : adj[node]) {
-        if (!vis[neighbor]) {
-            dfs(neighbor, adj, vis, result);
-        }
-    }
+// DFS traversal of a connected CSR graph starting from node 0
+// Runs on the iterative engine (explicit stack), so very deep graphs cannot overflow the call stack
+vector<int> dfsOfGraph(const CSRGraph& g) {
+    return dfsOrder(g, 0);       // Pre-order: node is recorded when it is first discovered
 }
 
-// DFS traversal of a connected graph starting from node 0
-vector<int> dfsOfGraph(int V, vector<vector<int>>& adj) {
-    vector<int> vis(V, 0);       // Visited array
-    vector<int> result;          // Stores the DFS traversal
-
-    dfs(0, adj, vis, result);    // Start DFS from node 0
+// Adjacency-list version: converts to CSR and reuses the same traversal (V = adj.size(), unused)
+vector<int> dfsOfGraph(int /*V*/, vector<vector<int>>& adj) {
+    return dfsOfGraph(buildCSR(adj));
+}
 
-    return result;
+// Edge-list versions: contiguous {u, v} structs or u[] / v[] columns, read in place
+vector<int> dfsOfGraph(int V, ArrayView<EdgeUV> edges, bool directed = true) {
+    return dfsOfGraph(buildCSR(V, edges, directed));
+}
+vector<int> dfsOfGraph(int V, const EdgeColumns& edges, bool directed = true) {
+    return dfsOfGraph(buildCSR(V, edges, directed));
 }
 
 int main() {
@@ -44,8 +42,11 @@ int main() {
     adj[3] = {1};
     adj[4] = {2};
 
+    // Build the CSR graph once, it can be shared by any number of queries
+    CSRGraph g = buildCSR(adj);
+
     // Perform DFS
-    vector<int> result = dfsOfGraph(V, adj);
+    vector<int> result = dfsOfGraph(g);
 
     // Output the DFS traversal
     cout << "DFS Traversal: ";
@@ -54,6 +55,13 @@ int main() {
     }
     cout << endl;
 
+    // A path 0 - 1 - 2 - ... with 3 million nodes: recursion would need 3 million stack frames
+    int n = 3000000;
+    vector<vector<int>> path;
+    for (int i = 0; i + 1 < n; i++) path.push_back({i, i + 1});
+    vector<int> deep = dfsOfGraph(buildCSR(n, path, false));
+    cout << "DFS on a path of " << n << " nodes visited " << deep.size() << " nodes" << endl;
+
     return 0;
 }
 
@@ -63,8 +71,8 @@ int main() {
 
 // Space Complexity:
 // Visited array → O(V)
-// Recursive call stack → up to O(V)
-// Adjacency list (input) → O(V + E)
+// Explicit DFS stack (inside the engine) → up to O(V), no recursion
+// Adjacency list / CSR graph (input) → O(V + E)
 // So, total SC = O(V + E)
 
 // Goal / Problem	Use
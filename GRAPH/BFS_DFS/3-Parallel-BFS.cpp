@@ -0,0 +1,150 @@
+// 🧵 What is a Parallel (level-synchronous) BFS?
+// BFS already works level by level: every node of level d is found before any node of level d + 1.
+// So all nodes of the current frontier can be expanded AT THE SAME TIME by different threads.
+
+// 🧠 Steps (one round per level)
+// 1. Threads grab chunks of the frontier through one atomic counter (dynamic load balancing).
+// 2. For each neighbor v, a thread tries to claim it with compare-and-swap on parent[v]:
+//    parent[v]: -1 → u. Only ONE thread can win, so every node is added exactly once.
+// 3. The winner appends v to its OWN local buffer (no shared queue, no lock).
+// 4. Barrier, then each thread copies its buffer into the next frontier at an offset
+//    computed from the sizes of the lower-numbered buffers (again no lock).
+// 5. Repeat until the frontier is empty.
+
+// ✅ Result: dist[] is exactly the same as serial BFS.
+// parent[] is a valid BFS tree (parent[v] is a neighbor at distance dist[v] - 1), but when a node
+// has several such neighbors the thread that wins the race decides which one is stored.
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "../CORE/generators.h"
+#include "bfs.h"   // bfsParallel, BFSTree (shared with the parallel SCC)
+using namespace std;
+
+// Serial BFS from any source (reference for the parallel version)
+BFSTree bfsSerial(const CSRGraph& g, int src) {
+    BFSTree res;
+    res.parent.assign(g.V, -1);
+    res.dist.assign(g.V, -1);
+
+    queue<int> q;
+    res.parent[src] = src;
+    res.dist[src] = 0;
+    q.push(src);
+
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+
+        for (int neighbor : g.neighbors(node)) {
+            if (res.parent[neighbor] == -1) {
+                res.parent[neighbor] = node;
+                res.dist[neighbor] = res.dist[node] + 1;
+                q.push(neighbor);
+            }
+        }
+    }
+
+    return res;
+}
+
+// Same distances as the serial BFS and every parent is one level above its child
+bool matchesSerial(const CSRGraph& g, const BFSTree& serial, const BFSTree& par, int src) {
+    if (serial.dist != par.dist) return false;
+    for (int v = 0; v < g.V; v++) {
+        if (v == src || par.dist[v] == -1) continue;
+        int p = par.parent[v];
+        if (p < 0 || par.dist[p] != par.dist[v] - 1) return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    // Small example: same graph as 1-BFS.cpp, starting from node 2
+    vector<vector<int>> edges = {{0, 1}, {0, 2}, {1, 3}, {2, 4}};
+    CSRGraph small = buildCSR(5, edges, false);
+
+    ThreadPool pool;
+    BFSTree tree = bfsParallel(small, 2, pool);
+
+    cout << "Parallel BFS from node 2 (" << pool.size() << " threads):" << endl;
+    for (int v = 0; v < small.V; v++) {
+        cout << "Node " << v << ": dist " << tree.dist[v] << ", parent " << tree.parent[v] << endl;
+    }
+
+    // Visit predicate: the same search, but never entering node 0 (so 1 and 3 stay unreachable)
+    BFSTree avoid0 = bfsParallel(small, 2, pool, [](int v) { return v != 0; });
+    cout << "Avoiding node 0, reached:";
+    for (int v = 0; v < small.V; v++) {
+        if (avoid0.dist[v] != -1) cout << " " << v;
+    }
+    cout << endl;
+
+    // 📈 Scaling benchmark on an RMAT graph: 1, 2, 4, ... up to all cores
+    int scale = argc > 1 ? atoi(argv[1]) : 18;
+    int edgeFactor = argc > 2 ? atoi(argv[2]) : 16;
+    CSRGraph g = buildCSR(1 << scale, rmatEdges(scale, edgeFactor), false, false);
+
+    // A few random non-isolated sources
+    mt19937 rng(7);
+    vector<int> sources;
+    while (sources.size() < 8) {
+        int s = rng() % g.V;
+        if (g.degree(s) > 0) sources.push_back(s);
+    }
+
+    vector<BFSTree> reference;
+    for (int s : sources) reference.push_back(bfsSerial(g, s));
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+    vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    cout << endl << "RMAT scale " << scale << " (V = " << g.V << ", E = " << g.numEdges() << ")" << endl;
+    cout << "Threads\tTime/BFS (ms)\tMTEPS\tSpeedup\tCorrect" << endl;
+
+    double baseTime = 0;
+    for (int T : threadCounts) {
+        ThreadPool team(T);
+        bool ok = true;
+        long long edgesTraversed = 0;
+        double ms = 0;
+
+        for (int i = 0; i < (int)sources.size(); i++) {
+            // Only the BFS itself is timed; checking and edge counting run after the clock stops
+            auto start = chrono::steady_clock::now();
+            BFSTree res = bfsParallel(g, sources[i], team);
+            ms += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+            ok = ok && matchesSerial(g, reference[i], res, sources[i]);
+            for (int v = 0; v < g.V; v++) {
+                if (res.dist[v] != -1) edgesTraversed += g.degree(v);
+            }
+        }
+
+        double perBfs = ms / sources.size();
+        if (T == 1) baseTime = perBfs;
+        cout << T << "\t" << perBfs << "\t" << edgesTraversed / (ms * 1000.0) << "\t"
+             << baseTime / perBfs << "\t" << (ok ? "yes" : "NO") << endl;
+    }
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Total work is still O(V + E): each node is claimed once, each edge is scanned once.
+// With T threads and D levels: about O((V + E) / T + D * barrier cost).
+// Low-diameter graphs (RMAT, social) have few levels → scale well.
+// Long paths / grids have many tiny levels → barriers dominate, little speedup.
+
+// 🧠 Space Complexity (SC):
+// parent (atomic) + dist → O(V)
+// frontier + next + per-thread buffers → O(V)
+// 👉 Total SC: O(V + E) including the CSR graph
@@ -0,0 +1,198 @@
+// 🚀 What is Multi-Source BFS (MS-BFS)?
+// When many BFS queries run on the SAME graph, separate BFS calls scan the same adjacency
+// lists again and again. MS-BFS runs up to 64 BFS's at once (one bit per search in a 64-bit word,
+// or 256 with 4 words) so ONE scan of adj[v] moves every search that is currently at v.
+
+// 🧠 Per vertex v we keep three bitmasks (bit i = search i):
+// seen[v]      → search i has already reached v
+// visit[v]     → v is in the current frontier of search i
+// visitNext[v] → v is in the next frontier of search i
+//
+// One level:
+//   for every v with visit[v] != 0:
+//       for every neighbor n:  visitNext[n] |= visit[v] & ~seen[n]   // all searches at once
+//   for every v with visitNext[v] != 0:
+//       seen[v] |= visitNext[v]  → every new bit i means "search i reached v at this depth"
+//
+// Note: this is different from the "multi-source BFS" that pushes all sources into ONE queue
+// (distance to the nearest source). Here every source keeps its own distances.
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <random>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+using namespace std;
+
+// W 64-bit words → 64 * W searches per batch
+template <int W>
+struct Lanes {
+    unsigned long long w[W];
+
+    bool any() const {
+        for (int i = 0; i < W; i++) if (w[i]) return true;
+        return false;
+    }
+};
+
+// Reusable MS-BFS engine: the bitmask arrays are allocated once per graph, not per query
+template <int W = 1>
+class MultiSourceBFS {
+public:
+    static const int BATCH = 64 * W;
+
+    explicit MultiSourceBFS(const CSRGraph& g)
+        : g(g), seen(g.V), visit(g.V), visitNext(g.V) {}
+
+    // Calls onVisit(sourceIndex, vertex, depth) once for every vertex reached by every source.
+    // Sources are processed in batches of BATCH.
+    template <typename Callback>
+    void run(const vector<int>& sources, Callback onVisit) {
+        for (int first = 0; first < (int)sources.size(); first += BATCH) {
+            int count = min(BATCH, (int)sources.size() - first);
+            runBatch(&sources[first], count, [&](int lane, int v, int depth) {
+                onVisit(first + lane, v, depth);
+            });
+        }
+    }
+
+    // dist[i][v] = distance from sources[i] to v, -1 if unreachable
+    vector<vector<int>> distances(const vector<int>& sources) {
+        vector<vector<int>> dist(sources.size(), vector<int>(g.V, -1));
+        run(sources, [&](int i, int v, int depth) { dist[i][v] = depth; });
+        return dist;
+    }
+
+private:
+    template <typename Callback>
+    void runBatch(const int* sources, int count, Callback onVisit) {
+        int V = g.V;
+        Lanes<W> zero = {};
+        fill(seen.begin(), seen.end(), zero);
+        fill(visit.begin(), visit.end(), zero);
+        fill(visitNext.begin(), visitNext.end(), zero);
+
+        // Every search starts at its own source (depth 0)
+        for (int lane = 0; lane < count; lane++) {
+            int s = sources[lane];
+            seen[s].w[lane >> 6] |= 1ULL << (lane & 63);
+            visit[s].w[lane >> 6] |= 1ULL << (lane & 63);
+            onVisit(lane, s, 0);
+        }
+
+        for (int depth = 1; ; depth++) {
+            // One scan of adj[v] advances every search that is at v
+            for (int v = 0; v < V; v++) {
+                if (!visit[v].any()) continue;
+
+                for (int neighbor : g.neighbors(v)) {
+                    for (int i = 0; i < W; i++) {
+                        visitNext[neighbor].w[i] |= visit[v].w[i] & ~seen[neighbor].w[i];
+                    }
+                }
+            }
+
+            // Record newly reached (search, vertex) pairs and build the next frontier
+            bool active = false;
+            for (int v = 0; v < V; v++) {
+                for (int i = 0; i < W; i++) {
+                    unsigned long long fresh = visitNext[v].w[i] & ~seen[v].w[i];
+                    seen[v].w[i] |= fresh;
+                    visit[v].w[i] = fresh;
+                    visitNext[v].w[i] = 0;
+
+                    if (fresh) active = true;
+                    while (fresh) {
+                        int bit = __builtin_ctzll(fresh);   // Lowest set bit = search id
+                        onVisit(i * 64 + bit, v, depth);
+                        fresh &= fresh - 1;
+                    }
+                }
+            }
+
+            if (!active) break;
+        }
+    }
+
+    const CSRGraph& g;
+    vector<Lanes<W>> seen, visit, visitNext;
+};
+
+// Plain BFS distances from one source (used to check MS-BFS)
+vector<int> bfsDistances(const CSRGraph& g, int src) {
+    vector<int> dist(g.V, -1);
+    queue<int> q;
+    dist[src] = 0;
+    q.push(src);
+
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        for (int neighbor : g.neighbors(node)) {
+            if (dist[neighbor] == -1) {
+                dist[neighbor] = dist[node] + 1;
+                q.push(neighbor);
+            }
+        }
+    }
+    return dist;
+}
+
+template <int W>
+double timeBatch(const CSRGraph& g, const vector<int>& sources, vector<vector<int>>& dist) {
+    MultiSourceBFS<W> msbfs(g);
+    auto start = chrono::steady_clock::now();
+    dist = msbfs.distances(sources);
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    // Small example: the graph from 1-BFS.cpp, three searches at once
+    vector<vector<int>> edges = {{0, 1}, {0, 2}, {1, 3}, {2, 4}};
+    CSRGraph small = buildCSR(5, edges, false);
+
+    MultiSourceBFS<1> msbfs(small);
+    vector<int> sources = {0, 3, 4};
+    vector<vector<int>> dist = msbfs.distances(sources);
+
+    for (int i = 0; i < (int)sources.size(); i++) {
+        cout << "Distances from " << sources[i] << ": ";
+        for (int d : dist[i]) cout << d << " ";
+        cout << endl;
+    }
+
+    // 📈 256 queries on an RMAT graph: one BFS per query vs batches of 64 and 256
+    CSRGraph g = buildCSR(1 << 16, rmatEdges(16, 16), false, false);
+    mt19937 rng(3);
+    vector<int> many(256);
+    for (int& s : many) s = rng() % g.V;
+
+    auto start = chrono::steady_clock::now();
+    vector<vector<int>> expected;
+    for (int s : many) expected.push_back(bfsDistances(g, s));
+    double serialMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    vector<vector<int>> got64, got256;
+    double ms64 = timeBatch<1>(g, many, got64);
+    double ms256 = timeBatch<4>(g, many, got256);
+
+    cout << endl << "256 BFS queries on RMAT scale 16:" << endl;
+    cout << "One BFS per query:  " << serialMs << " ms" << endl;
+    cout << "MS-BFS, 64 / batch:  " << ms64 << " ms (" << (got64 == expected ? "same" : "DIFFERENT") << " distances)" << endl;
+    cout << "MS-BFS, 256 / batch: " << ms256 << " ms (" << (got256 == expected ? "same" : "DIFFERENT") << " distances)" << endl;
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// One batch of B = 64 * W searches with D levels:
+//   each level scans V bitmasks + the edges of the active vertices → O(D * V + E * W) in the worst case
+// vs B separate BFS's → O(B * (V + E))
+// Every adjacency list is read once per level for the whole batch instead of once per search.
+
+// 🧠 Space Complexity (SC):
+// seen + visit + visitNext → 3 * V * W words, allocated once per engine and reused for every batch
+// Output distances (if requested) → O(B * V)
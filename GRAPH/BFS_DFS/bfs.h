@@ -0,0 +1,258 @@
+// 📚 BFS routines on the shared CSR graph (explained and demonstrated in 1-BFS.cpp).
+// Kept in a header so other programs (reordering pass, benchmarks) call the very same code.
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <atomic>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+using namespace std;
+
+// Function to perform BFS traversal of a CSR (or compressed) graph (from node 0 unless another source is given)
+template <typename Graph>
+vector<int> bfsOfGraph(const Graph& g, int src = 0) {
+    vector<int> bfs;         // Stores the BFS traversal result
+    vector<int> vis(g.V, 0); // Visited array to keep track of visited nodes
+    queue<int> q;            // Queue for BFS
+
+    vis[src] = 1;            // Start BFS from the source node
+    q.push(src);
+
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        bfs.push_back(node); // Process current node
+
+        // Visit all adjacent unvisited nodes
+        for (int neighbor : g.neighbors(node)) {
+            if (!vis[neighbor]) {
+                vis[neighbor] = 1;   // Mark as visited
+                q.push(neighbor);    // Add to queue for further exploration
+            }
+        }
+    }
+
+    return bfs;
+}
+
+// Adjacency-list version: converts to CSR and reuses the same traversal (V = adj.size(), unused)
+inline vector<int> bfsOfGraph(int /*V*/, vector<vector<int>>& adj) {
+    return bfsOfGraph(buildCSR(adj));
+}
+
+// Edge-list versions: contiguous {u, v} structs or u[] / v[] columns, read in place (from node 0)
+inline vector<int> bfsOfGraph(int V, ArrayView<EdgeUV> edges, bool directed = true) {
+    return bfsOfGraph(buildCSR(V, edges, directed));
+}
+inline vector<int> bfsOfGraph(int V, const EdgeColumns& edges, bool directed = true) {
+    return bfsOfGraph(buildCSR(V, edges, directed));
+}
+
+// ⚡ Direction-Optimizing BFS (top-down + bottom-up)
+// Top-down step: every frontier node scans its neighbors (classic BFS).
+// Bottom-up step: every UNVISITED node scans its parents and stops at the first one
+// that is in the frontier. When the frontier is huge (middle levels of low-diameter,
+// power-law graphs) this checks far fewer edges than top-down.
+// Switching rule (Beamer et al.):
+//   top-down → bottom-up when edges out of frontier * alpha > edges out of unvisited nodes
+//   bottom-up → top-down when frontier size * beta < V
+// alpha = 0 disables bottom-up steps (pure top-down).
+// Same levels and same visited set as bfsOfGraph, but not always the same order: a bottom-up step
+// scans the unvisited nodes by id, so that level lists its nodes in vertex-id order, not in the
+// order the queue would have discovered them. Top-down levels (and alpha = 0) match bfsOfGraph exactly.
+
+// Bitmap with one bit per vertex (64 vertices per word)
+struct Bitmap {
+    vector<unsigned long long> words;
+
+    Bitmap(int n = 0) : words((n + 63) / 64, 0) {}
+    void set(int i) { words[i >> 6] |= 1ULL << (i & 63); }
+    bool test(int i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+    void clear() { fill(words.begin(), words.end(), 0); }
+};
+
+struct DOBFSResult {
+    vector<int> order;              // Level by level; bottom-up levels are in vertex-id order
+    vector<int> level;              // level[v] = distance from source, -1 if unreachable
+    vector<bool> bottomUp;          // bottomUp[d] = true if level d -> d + 1 was expanded bottom-up
+    vector<long long> edgesChecked; // Edges examined while expanding level d (for tuning alpha / beta)
+};
+
+// g must contain out-edges, inG in-edges (for an undirected graph both are the same graph)
+inline DOBFSResult bfsDirectionOptimizing(const CSRGraph& g, const CSRGraph& inG, int src = 0,
+                                          int alpha = 15, int beta = 18) {
+    int V = g.V;
+    DOBFSResult res;
+    res.level.assign(V, -1);
+
+    Bitmap visited(V), frontierBits(V);
+    vector<int> frontier = {src}, next;   // Frontier kept as a list (top-down) and a bitmap (bottom-up)
+
+    visited.set(src);
+    res.level[src] = 0;
+    res.order.push_back(src);
+
+    long long frontierEdges = g.degree(src);                    // m_f: edges out of the frontier
+    long long unvisitedEdges = g.numEdges() - frontierEdges;    // m_u: edges out of unvisited nodes
+    bool useBottomUp = false;
+
+    for (int depth = 0; !frontier.empty(); depth++) {
+        // Pick the direction for this level
+        if (!useBottomUp && alpha > 0 && frontierEdges * alpha > unvisitedEdges)
+            useBottomUp = true;
+        else if (useBottomUp && (long long)frontier.size() * beta < V)
+            useBottomUp = false;
+
+        next.clear();
+        long long checked = 0;
+
+        if (!useBottomUp) {
+            // Top-down: push from every frontier node to its unvisited neighbors
+            for (int node : frontier) {
+                for (int neighbor : g.neighbors(node)) {
+                    checked++;
+                    if (!visited.test(neighbor)) {
+                        visited.set(neighbor);
+                        res.level[neighbor] = depth + 1;
+                        next.push_back(neighbor);
+                    }
+                }
+            }
+        } else {
+            // Bottom-up: every unvisited node looks for a parent in the frontier
+            frontierBits.clear();
+            for (int node : frontier) frontierBits.set(node);
+
+            for (int node = 0; node < V; node++) {
+                // Skip 64 nodes at once when the whole word is already visited
+                if ((node & 63) == 0 && visited.words[node >> 6] == ~0ULL) {
+                    node += 63;
+                    continue;
+                }
+                if (visited.test(node)) continue;
+
+                for (int parent : inG.neighbors(node)) {
+                    checked++;
+                    if (frontierBits.test(parent)) {
+                        res.level[node] = depth + 1;
+                        next.push_back(node);
+                        break;   // One parent is enough
+                    }
+                }
+            }
+            // Mark after the scan so nodes found in this step don't act as parents of each other
+            for (int node : next) visited.set(node);
+        }
+
+        // Update the edge counts used by the switching rule
+        frontierEdges = 0;
+        for (int node : next) frontierEdges += g.degree(node);
+        unvisitedEdges -= frontierEdges;
+
+        res.bottomUp.push_back(useBottomUp);
+        res.edgesChecked.push_back(checked);
+        res.order.insert(res.order.end(), next.begin(), next.end());
+        frontier.swap(next);
+    }
+
+    return res;
+}
+
+// Undirected graph: in-neighbors are the same as out-neighbors
+inline DOBFSResult bfsDirectionOptimizing(const CSRGraph& g, int src = 0, int alpha = 15, int beta = 18) {
+    return bfsDirectionOptimizing(g, g, src, alpha, beta);
+}
+
+// 🧵 Level-synchronous parallel BFS (explained and benchmarked in 3-Parallel-BFS.cpp)
+// Threads grab chunks of the frontier, claim neighbors with compare-and-swap and collect them in
+// per-thread buffers that are merged into the next frontier without a lock.
+// tryVisit(node, neighbor, depth) is called for every edge out of the frontier (node is at level
+// depth); it must return true for exactly ONE call per newly reached neighbor (the CAS winner),
+// which then joins the next frontier. Shared by bfsParallel and the SCC reachability searches.
+template <typename TryVisit>
+void parallelLevelSync(const CSRGraph& g, int src, ThreadPool& pool, TryVisit tryVisit) {
+    int T = pool.size();
+    vector<int> frontier = {src}, next;
+    vector<vector<int>> local(T);   // Per-thread buffers for the next frontier
+    ChunkQueue work;
+    work.reset(frontier.size());
+    Barrier barrier(T);
+    int depth = 0;
+    bool done = false;
+
+    pool.run([&](int tid) {
+        while (true) {
+            // Expand my share of the frontier
+            local[tid].clear();
+            long long begin, end;
+            while (work.grab(begin, end)) {
+                for (long long i = begin; i < end; i++) {
+                    int node = frontier[i];
+                    for (int neighbor : g.neighbors(node)) {
+                        if (tryVisit(node, neighbor, depth)) local[tid].push_back(neighbor);
+                    }
+                }
+            }
+            barrier.wait();
+
+            // Merge the local buffers into the next frontier without a lock
+            if (tid == 0) next.resize(mergeSize(local));
+            barrier.wait();
+            copy(local[tid].begin(), local[tid].end(), next.begin() + mergeOffset(local, tid));
+            barrier.wait();
+
+            // One thread moves to the next level
+            if (tid == 0) {
+                frontier.swap(next);
+                work.reset(frontier.size());
+                depth++;
+                done = frontier.empty();
+            }
+            barrier.wait();
+
+            if (done) break;
+        }
+    });
+}
+
+struct BFSTree {
+    vector<int> parent;   // parent[src] = src, -1 if unreachable
+    vector<int> dist;     // Number of edges from src, -1 if unreachable
+};
+
+// Default visit predicate: every vertex may be entered
+struct VisitAll {
+    bool operator()(int) const { return true; }
+};
+
+// Parallel BFS on every thread of the pool, only entering vertices with canVisit(v) (src always).
+// dist[] is the same as a serial BFS; parent[] is a valid BFS tree, but when a node has several
+// neighbors one level up, the thread that wins the race decides which one is stored.
+template <typename CanVisit = VisitAll>
+BFSTree bfsParallel(const CSRGraph& g, int src, ThreadPool& pool, CanVisit canVisit = CanVisit()) {
+    int V = g.V;
+    BFSTree res;
+    res.dist.assign(V, -1);
+    vector<atomic<int>> parent(V);
+    for (int v = 0; v < V; v++) parent[v].store(-1, memory_order_relaxed);
+
+    parent[src].store(src, memory_order_relaxed);
+    res.dist[src] = 0;
+
+    parallelLevelSync(g, src, pool, [&](int node, int neighbor, int depth) {
+        // Cheap read first, CAS only if the node still looks unclaimed
+        if (parent[neighbor].load(memory_order_relaxed) != -1 || !canVisit(neighbor)) return false;
+
+        int expected = -1;
+        if (!parent[neighbor].compare_exchange_strong(expected, node, memory_order_relaxed)) return false;
+        res.dist[neighbor] = depth + 1;   // Only the CAS winner writes
+        return true;
+    });
+
+    res.parent.resize(V);
+    for (int v = 0; v < V; v++) res.parent[v] = parent[v].load(memory_order_relaxed);
+    return res;
+}
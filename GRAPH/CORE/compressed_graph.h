@@ -0,0 +1,405 @@
+// 🗜️ Compressed adjacency (delta + group varint, StreamVByte-style)
+// A CSR graph spends 4 bytes on every neighbor id. Once each neighbor list is SORTED, the gaps
+// between consecutive neighbors are small numbers, and most of them fit in 1 or 2 bytes.
+// So each list is stored as gaps with a variable byte length, and decoded on the fly while
+// the traversal walks over the neighbors.
+
+// 📄 Layout of the list of vertex u (starts at bytes[offsets[u]])
+//   degree           LEB128 varint (7 bits per byte, high bit = "more bytes follow")
+//   groups of 4 gaps [control byte][data bytes]
+//                    the control byte holds 4 x 2 bits = byte length - 1 of each gap (1..4 bytes)
+//   gap 0 = zigzag(first neighbor - u)   (neighbors are often close to u, may be smaller than u)
+//   gap i = neighbor[i] - neighbor[i - 1]
+// Like StreamVByte, a gap's length comes from a table lookup on the control byte, not from
+// testing every byte, so decoding has no data-dependent branches. (StreamVByte keeps all control
+// bytes in a separate stream and decodes 4 gaps with one SIMD shuffle; here control and data are
+// interleaved per list, which keeps each list self-contained and the decoder portable.)
+
+// 🔧 Usage: CompressedGraph cg = compressGraph(csr); then for (int v : cg.neighbors(u)) { ... }
+// Graphs too big to build as CSR first: compressGraphFile(".csr file") or compressEdgeFile("edge list").
+// Traversal code written against V / neighbors(u) (bfsOfGraph, kahnTopoSort, the DFS engine, ...)
+// runs on it unchanged. Neighbors come out in increasing id order.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "csr_graph.h"
+#include "dfs_engine.h"
+#include "graph_file.h"   // MappedGraph, EdgeListReader
+using namespace std;
+
+inline uint32_t zigzagEncode(int32_t x) { return ((uint32_t)x << 1) ^ (uint32_t)(x >> 31); }
+inline int32_t zigzagDecode(uint32_t z) { return (int32_t)(z >> 1) ^ -(int32_t)(z & 1); }
+
+// Reads the gaps of one neighbor list, one neighbor per next() call
+struct CompressedCursor {
+    const uint8_t* p = nullptr;   // Next byte to read (a control byte when lane == 4)
+    int left = 0;                 // Neighbors not decoded yet
+    int prev = 0;                 // Last decoded neighbor (u before the first one)
+    uint8_t ctrl = 0;             // Control byte of the current group
+    uint8_t lane = 4;             // Next gap inside the group (4 → read a new control byte)
+    bool first = true;
+
+    bool next(int& v) {
+        static const uint32_t mask[5] = {0, 0xFFu, 0xFFFFu, 0xFFFFFFu, 0xFFFFFFFFu};
+        if (left == 0) return false;
+        if (lane == 4) {
+            ctrl = *p++;
+            lane = 0;
+        }
+        int len = ((ctrl >> (2 * lane)) & 3) + 1;
+        uint32_t word;
+        memcpy(&word, p, 4);                 // Always safe: the byte array is padded
+        uint32_t gap = word & mask[len];
+        p += len;
+        lane++;
+        left--;
+
+        prev = first ? prev + zigzagDecode(gap) : prev + (int)gap;
+        first = false;
+        v = prev;
+        return true;
+    }
+};
+
+// Range over the neighbors of one vertex, so we can write: for (int v : cg.neighbors(u))
+struct CompressedNeighborRange {
+    struct iterator {
+        CompressedCursor cursor;
+        int value = 0;
+        bool done = true;
+
+        int operator*() const { return value; }
+        iterator& operator++() { done = !cursor.next(value); return *this; }
+        bool operator!=(const iterator& other) const { return done != other.done; }
+    };
+
+    CompressedCursor start;
+
+    iterator begin() const {
+        iterator it;
+        it.cursor = start;
+        ++it;
+        return it;
+    }
+    iterator end() const { return iterator(); }
+};
+
+// 📇 Offsets: a plain uint64 per vertex would cost 8 bytes per vertex, more than the lists of a
+// sparse graph (a grid has ~4 edges per vertex). Instead vertices are grouped in blocks of
+// OFFSET_BLOCK: every block keeps one 64-bit start, every vertex a 16-bit position inside its block.
+// The rare block whose lists span more than 64 KB (hubs) is "wide" and keeps 64-bit offsets for
+// its vertices in a side array → about 2.2 bytes per vertex instead of 8.
+const int OFFSET_BLOCK = 64;
+const uint32_t NARROW_BLOCK = UINT32_MAX;
+
+struct CompressedGraph {
+    int V = 0;
+    long long E = 0;                 // Stored (directed) edges
+    vector<uint64_t> blockStart;     // Byte position of the first list of each block
+    vector<uint32_t> blockWide;      // NARROW_BLOCK, or where the block's entries start in wideOffsets
+    vector<uint16_t> localOffset;    // Size V, position of u's list relative to its block start
+    vector<uint64_t> wideOffsets;    // OFFSET_BLOCK absolute positions per wide block
+    vector<uint8_t> bytes;           // All encoded lists + 3 padding bytes
+
+    long long numEdges() const { return E; }
+
+    // Byte position of u's list
+    uint64_t offset(int u) const {
+        int b = u / OFFSET_BLOCK;
+        uint32_t wide = blockWide[b];
+        return wide == NARROW_BLOCK ? blockStart[b] + localOffset[u] : wideOffsets[wide + u % OFFSET_BLOCK];
+    }
+
+    // Position right after the degree varint
+    const uint8_t* listStart(int u, int& deg) const {
+        const uint8_t* p = bytes.data() + offset(u);
+        uint32_t d = 0;
+        for (int shift = 0;; shift += 7) {
+            uint8_t b = *p++;
+            d |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+        }
+        deg = (int)d;
+        return p;
+    }
+
+    int degree(int u) const {
+        int deg;
+        listStart(u, deg);
+        return deg;
+    }
+
+    CompressedCursor cursor(int u) const {
+        CompressedCursor c;
+        c.p = listStart(u, c.left);
+        c.prev = u;
+        return c;
+    }
+
+    CompressedNeighborRange neighbors(int u) const { return {cursor(u)}; }
+
+    // Memory of the offset index (everything except the encoded lists)
+    size_t indexBytes() const {
+        return blockStart.size() * sizeof(uint64_t) + blockWide.size() * sizeof(uint32_t)
+             + localOffset.size() * sizeof(uint16_t) + wideOffsets.size() * sizeof(uint64_t);
+    }
+
+    // Total memory of the compressed graph per stored edge
+    double bytesPerEdge() const {
+        return E == 0 ? 0 : (double)(bytes.size() + indexBytes()) / E;
+    }
+};
+
+// Memory of the plain CSR layout per stored edge (offsets + adj, weights not counted)
+inline double csrBytesPerEdge(const CSRGraph& g) {
+    return g.numEdges() == 0 ? 0 : (double)(g.offsets.size() + g.adj.size()) * sizeof(int) / g.numEdges();
+}
+
+// Encoder: takes the neighbor lists of vertices 0, 1, ..., V - 1 one at a time, in that order,
+// so a caller can produce them from any source (a CSR graph, a mapped file, slices of an edge stream)
+// without holding more than one list next to the output.
+class CompressedGraphBuilder {
+public:
+    explicit CompressedGraphBuilder(int V, size_t expectedBytes = 0) {
+        cg.V = V;
+        int blocks = (V + OFFSET_BLOCK - 1) / OFFSET_BLOCK;
+        cg.blockStart.reserve(blocks);
+        cg.blockWide.reserve(blocks);
+        cg.localOffset.resize(V);
+        cg.bytes.reserve(expectedBytes + 3);
+    }
+
+    int nextVertex() const { return u; }
+
+    // Append the list of vertex nextVertex(); the list is sorted in place
+    void add(vector<int>& list) {
+        sort(list.begin(), list.end());
+        int b = u / OFFSET_BLOCK;
+        if (u % OFFSET_BLOCK == 0) {
+            cg.blockStart.push_back(cg.bytes.size());
+            cg.blockWide.push_back(NARROW_BLOCK);
+        }
+        uint64_t rel = cg.bytes.size() - cg.blockStart[b];
+        if (cg.blockWide[b] == NARROW_BLOCK && rel > UINT16_MAX) {
+            // This block outgrew 16-bit positions: move its vertices to absolute offsets
+            cg.blockWide[b] = cg.wideOffsets.size();
+            for (int k = 0; k < OFFSET_BLOCK; k++) {
+                int w = b * OFFSET_BLOCK + k;
+                cg.wideOffsets.push_back(w < u ? cg.blockStart[b] + cg.localOffset[w] : 0);
+            }
+        }
+        if (cg.blockWide[b] == NARROW_BLOCK) cg.localOffset[u] = (uint16_t)rel;
+        else cg.wideOffsets[cg.blockWide[b] + u % OFFSET_BLOCK] = cg.bytes.size();
+
+        uint32_t d = list.size();                       // Degree as LEB128 varint
+        while (d >= 0x80) {
+            cg.bytes.push_back((uint8_t)(d | 0x80));
+            d >>= 7;
+        }
+        cg.bytes.push_back((uint8_t)d);
+
+        for (size_t i = 0; i < list.size(); i += 4) {
+            size_t ctrlPos = cg.bytes.size();
+            cg.bytes.push_back(0);
+            uint8_t ctrl = 0;
+            for (size_t k = i; k < min(i + 4, list.size()); k++) {
+                uint32_t gap = k == 0 ? zigzagEncode(list[0] - u) : (uint32_t)(list[k] - list[k - 1]);
+                int len = gap < (1u << 8) ? 1 : gap < (1u << 16) ? 2 : gap < (1u << 24) ? 3 : 4;
+                ctrl |= (len - 1) << (2 * (k - i));
+                for (int byte = 0; byte < len; byte++) cg.bytes.push_back((uint8_t)(gap >> (8 * byte)));
+            }
+            cg.bytes[ctrlPos] = ctrl;
+        }
+        cg.E += list.size();
+        u++;
+    }
+
+    // Call once, after the list of vertex V - 1
+    CompressedGraph finish() {
+        cg.bytes.insert(cg.bytes.end(), 3, 0);          // The decoder reads 4 bytes at a time
+        cg.bytes.shrink_to_fit();
+        return move(cg);
+    }
+
+private:
+    CompressedGraph cg;
+    int u = 0;
+};
+
+// Encode a CSR graph (weights are dropped: the compressed graph is for traversals).
+// Works on a MappedGraph's graph() as well: the file is read once, front to back, straight from the mapping.
+inline CompressedGraph compressGraph(const CSRGraph& g) {
+    CompressedGraphBuilder builder(g.V, g.numEdges() + 2 * (size_t)g.V);   // Rough guess: ~1 byte per gap
+    vector<int> list;
+    for (int u = 0; u < g.V; u++) {
+        list.assign(g.neighbors(u).begin(), g.neighbors(u).end());
+        builder.add(list);
+    }
+    return builder.finish();
+}
+
+// Encode a .csr graph file without loading it into the heap (see graph_file.h)
+inline bool compressGraphFile(const string& path, CompressedGraph& cg, string& error) {
+    MappedGraph file;
+    if (!file.open(path, error)) return false;
+    cg = compressGraph(file.graph());
+    return true;
+}
+
+// 📥 Encode a text edge list (EdgeListReader format, weights ignored) without ever building the CSR
+// graph: pass 1 counts degrees, then every further pass re-reads the file, keeps only the edges whose
+// source lies in the next range of vertices (at most maxBufferedEdges of them) and encodes that range.
+// Peak memory = degrees + one buffer of maxBufferedEdges ids + the output; passes = 1 + E / maxBufferedEdges.
+inline bool compressEdgeFile(const string& path, bool directed, CompressedGraph& cg, string& error,
+                             size_t maxBufferedEdges = 1 << 24, size_t chunkEdges = 1 << 16) {
+    EdgeListReader in;
+    if (!in.open(path, false, error)) return false;
+    vector<EdgeUV> chunk(chunkEdges);
+
+    vector<long long> degree;
+    long long E = 0;
+    while (size_t n = in.read(chunk.data(), chunk.size())) {
+        if ((int)degree.size() < in.numVertices()) degree.resize(max((size_t)in.numVertices(), degree.size() * 2));
+        for (size_t i = 0; i < n; i++) {
+            degree[chunk[i].u]++;
+            if (!directed) degree[chunk[i].v]++;
+        }
+        E += directed ? n : 2 * n;
+    }
+    if (!in.ok()) {
+        error = in.error();
+        return false;
+    }
+
+    int V = in.numVertices();
+    CompressedGraphBuilder builder(V, E + 2 * (size_t)V);
+    vector<long long> start;                      // Offsets of the buffered range, like CSR offsets
+    vector<int> buffer, list;
+    bool changed = false;                         // More edges than pass 1 counted (file rewritten meanwhile)
+
+    for (int lo = 0; lo < V;) {
+        // Next range [lo, hi): as many vertices as fit in the buffer, at least one
+        int hi = lo;
+        long long size = 0;
+        while (hi < V && (hi == lo || size + degree[hi] <= (long long)maxBufferedEdges)) size += degree[hi++];
+
+        start.assign(hi - lo + 1, 0);
+        for (int u = lo; u < hi; u++) start[u - lo + 1] = start[u - lo] + degree[u];
+        vector<long long> cursor(start.begin(), start.end() - 1);
+        buffer.resize(size);
+
+        in.rewind();
+        while (size_t n = in.read(chunk.data(), chunk.size())) {
+            for (size_t i = 0; i < n; i++) {
+                const EdgeUV& e = chunk[i];
+                if (e.u >= lo && e.u < hi && cursor[e.u - lo] < start[e.u - lo + 1]) buffer[cursor[e.u - lo]++] = e.v;
+                else if (e.u >= lo && e.u < hi) changed = true;
+                if (directed || e.v < lo || e.v >= hi) continue;
+                if (cursor[e.v - lo] < start[e.v - lo + 1]) buffer[cursor[e.v - lo]++] = e.u;
+                else changed = true;
+            }
+        }
+        if (!in.ok()) {
+            error = in.error();
+            return false;
+        }
+        if (changed || in.numVertices() != V) {
+            error = path + " changed while it was being read";
+            return false;
+        }
+
+        for (int u = lo; u < hi; u++) {
+            list.assign(buffer.begin() + start[u - lo], buffer.begin() + start[u - lo + 1]);
+            builder.add(list);
+        }
+        lo = hi;
+    }
+
+    cg = builder.finish();
+    return true;
+}
+
+
+// 🔁 DFS engine on the compressed graph: same hooks and behavior as dfsFrom / dfsForest in
+// dfs_engine.h, but each stack frame keeps a decoding cursor instead of an edge index.
+
+struct CompressedDFSFrame {
+    int v;
+    CompressedCursor it;
+};
+
+struct CompressedDFSWorkspace {
+    vector<char> state;
+    vector<CompressedDFSFrame> stack;
+
+    void reset(int V) {
+        state.assign(V, WHITE);
+        if ((int)stack.size() < V) stack.resize(V);
+    }
+};
+
+template <>
+struct DFSWorkspaceFor<CompressedGraph> {
+    typedef CompressedDFSWorkspace type;
+};
+
+template <typename Discover, typename Finish, typename BackEdge>
+bool dfsFrom(const CompressedGraph& g, int root, CompressedDFSWorkspace& ws,
+             Discover&& discover, Finish&& finish, BackEdge&& backEdge) {
+    CompressedDFSFrame* stack = ws.stack.data();
+    int top = 0;
+
+    ws.state[root] = GRAY;
+    if (!discover(root, -1)) return false;
+    stack[top++] = {root, g.cursor(root)};
+
+    while (top > 0) {
+        CompressedDFSFrame& frame = stack[top - 1];
+        int to;
+
+        if (frame.it.next(to)) {
+            int u = frame.v;
+            if (ws.state[to] == WHITE) {
+                ws.state[to] = GRAY;
+                if (!discover(to, u)) return false;
+                stack[top++] = {to, g.cursor(to)};
+            } else if (ws.state[to] == GRAY) {
+                if (!backEdge(u, to)) return false;
+            }
+        } else {
+            ws.state[frame.v] = BLACK;
+            if (!finish(frame.v)) return false;
+            top--;
+        }
+    }
+
+    return true;
+}
+
+template <typename Discover, typename Finish, typename BackEdge>
+bool dfsForest(const CompressedGraph& g, CompressedDFSWorkspace& ws,
+               Discover&& discover, Finish&& finish, BackEdge&& backEdge) {
+    ws.reset(g.V);
+    for (int root = 0; root < g.V; root++) {
+        if (ws.state[root] == WHITE && !dfsFrom(g, root, ws, discover, finish, backEdge))
+            return false;
+    }
+    return true;
+}
+
+
+// ⏱ Time Complexity (TC):
+// compressGraph → O(V + E log(max degree)) (lists are sorted once)
+// compressEdgeFile → O(E) parsing per pass, 1 + E / maxBufferedEdges passes, plus the same sorting
+// offset(u) → O(1): one block lookup + one 16-bit (or wide 64-bit) entry
+// Iterating the neighbors of u → O(deg(u)), a few shifts / masks per neighbor
+
+// 🧠 Space Complexity (SC):
+// About 2.2 bytes per vertex of offsets (2 per vertex + 12 per block of 64, + 512 per wide block)
+// + about 1-2 bytes per edge for sorted, local neighbor lists
+// (worst case 4 bytes per gap + 1 control byte per 4 gaps), vs 4 * (V + 1 + E) bytes for CSR
@@ -0,0 +1,283 @@
+// 📦 What is a CSR (Compressed Sparse Row) graph?
+// Instead of one vector per vertex (vector<vector<int>>), all neighbor lists are stored
+// back to back in ONE contiguous array, and a second array of offsets tells where each
+// vertex's slice starts and ends.
+//
+//   offsets: [0, 2, 4, 6, 7, 8]        → neighbors of u live in adj[offsets[u] .. offsets[u+1])
+//   adj:     [1, 2, 0, 3, 0, 4, 1, 2]
+//
+// ✅ Why CSR?
+// Only 2 (or 3 with weights) heap allocations for the whole graph instead of one per vertex.
+// Neighbor scans walk straight through memory → no pointer chasing, cache friendly.
+// The graph is built once and then shared (read-only) by every algorithm / query.
+
+#pragma once
+
+#include <vector>
+#include <utility>
+using namespace std;
+
+// Structure to represent an edge from u to v with a given weight
+struct Edge {
+    int u, v, weight;
+};
+
+// Unweighted edge u -> v: 8 bytes, stored back to back in a flat array.
+// vector<vector<int>> spends one heap allocation (~32 bytes + 24 bytes of vector header) per edge.
+struct EdgeUV {
+    int u, v;
+};
+
+// Read-only view over a contiguous array owned by someone else (like C++20 std::span):
+// a vector, a chunk filled by EdgeListReader (graph_file.h), a memory-mapped file, ...
+// Nothing is copied; the owner must outlive the view.
+template <typename T>
+struct ArrayView {
+    const T* first = nullptr;
+    size_t count = 0;
+
+    ArrayView() {}
+    ArrayView(const T* data, size_t size) : first(data), count(size) {}
+    ArrayView(const vector<T>& v) : first(v.data()), count(v.size()) {}
+
+    const T* begin() const { return first; }
+    const T* end() const { return first + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](size_t i) const { return first[i]; }
+};
+
+// Struct-of-arrays edge list: edge i is u[i] -> v[i] with weight w[i] (w empty = unweighted)
+struct EdgeColumns {
+    ArrayView<int> u, v, w;
+    size_t size() const { return u.size(); }
+};
+
+// Read-only view over the neighbors of one vertex, so we can write: for (int v : g.neighbors(u))
+struct NeighborRange {
+    const int* first;
+    const int* last;
+    const int* begin() const { return first; }
+    const int* end() const { return last; }
+    int size() const { return (int)(last - first); }
+};
+
+// Array of ints used inside CSRGraph. Works like a small vector<int>, but it can also just
+// point at memory owned by someone else (e.g. a memory-mapped graph file, see graph_file.h),
+// so a graph can be used without copying its arrays.
+class GraphArray {
+public:
+    GraphArray() {}
+    GraphArray(const GraphArray& other) { *this = other; }
+    GraphArray(GraphArray&& other) noexcept { *this = move(other); }
+
+    GraphArray& operator=(const GraphArray& other) {
+        if (this == &other) return *this;
+        own = other.own;
+        if (other.borrowed) borrow(other.ptr, other.n);
+        else sync();
+        return *this;
+    }
+
+    GraphArray& operator=(GraphArray&& other) noexcept {
+        if (this == &other) return *this;
+        own = move(other.own);
+        if (other.borrowed) borrow(other.ptr, other.n);
+        else sync();
+        other.own.clear();
+        other.sync();
+        return *this;
+    }
+
+    // Point at external memory (not copied, not freed; must outlive this array)
+    void borrow(const int* data, size_t count) {
+        own.clear();
+        ptr = data;
+        n = count;
+        borrowed = true;
+    }
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+    const int* data() const { return ptr; }
+    const int* begin() const { return ptr; }
+    const int* end() const { return ptr + n; }
+    const int& operator[](size_t i) const { return ptr[i]; }
+    int& operator[](size_t i) { return const_cast<int*>(ptr)[i]; }   // Only for owned arrays
+
+    // vector-like building operations (always switch to owned memory)
+    void assign(size_t count, int value) { own.assign(count, value); sync(); }
+    void resize(size_t count) { own.resize(count); sync(); }
+    void reserve(size_t count) { own.reserve(count); sync(); }
+    void push_back(int value) { own.push_back(value); sync(); }
+    template <typename It>
+    void append(It first, It last) { own.insert(own.end(), first, last); sync(); }
+
+private:
+    void sync() {
+        ptr = own.data();
+        n = own.size();
+        borrowed = false;
+    }
+
+    vector<int> own;            // Storage when the array owns its memory
+    const int* ptr = nullptr;   // Current data (own.data() or borrowed memory)
+    size_t n = 0;
+    bool borrowed = false;
+};
+
+struct CSRGraph {
+    int V = 0;                 // Number of vertices
+    GraphArray offsets;        // Size V + 1, slice of vertex u is [offsets[u], offsets[u + 1])
+    GraphArray adj;            // All neighbor lists stored contiguously
+    GraphArray weights;        // weights[i] is the weight of edge adj[i] (empty if unweighted)
+
+    int numEdges() const { return (int)adj.size(); }
+    bool isWeighted() const { return !weights.empty(); }
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+
+    NeighborRange neighbors(int u) const {
+        return {adj.data() + offsets[u], adj.data() + offsets[u + 1]};
+    }
+};
+
+// Build a CSR graph from an edge list in one counting pass + one fill pass.
+// Neighbors keep the order in which edges appear in the input, so traversals give the
+// same order as the classic adj[u].push_back(v) adjacency list.
+// edgeAt(i) must return {u, v, weight} for the i-th input edge.
+template <typename EdgeAt>
+CSRGraph buildCSRFrom(int V, int E, EdgeAt edgeAt, bool directed, bool weighted) {
+    CSRGraph g;
+    g.V = V;
+    g.offsets.assign(V + 1, 0);
+
+    // Pass 1: count out-degree of every vertex
+    for (int i = 0; i < E; i++) {
+        Edge e = edgeAt(i);
+        g.offsets[e.u + 1]++;
+        if (!directed) g.offsets[e.v + 1]++;
+    }
+
+    // Prefix sum turns degrees into starting offsets
+    for (int u = 0; u < V; u++) {
+        g.offsets[u + 1] += g.offsets[u];
+    }
+
+    g.adj.resize(g.offsets[V]);
+    if (weighted) g.weights.resize(g.offsets[V]);
+
+    // Pass 2: drop every edge into its slot (cursor[u] = next free slot of u)
+    vector<int> cursor(g.offsets.begin(), g.offsets.end() - 1);
+    for (int i = 0; i < E; i++) {
+        Edge e = edgeAt(i);
+        int pos = cursor[e.u]++;
+        g.adj[pos] = e.v;
+        if (weighted) g.weights[pos] = e.weight;
+
+        if (!directed) {
+            pos = cursor[e.v]++;
+            g.adj[pos] = e.u;
+            if (weighted) g.weights[pos] = e.weight;
+        }
+    }
+
+    return g;
+}
+
+// Unweighted edge list: edges[i] = {u, v}
+inline CSRGraph buildCSR(int V, const vector<vector<int>>& edges, bool directed = true) {
+    return buildCSRFrom(V, (int)edges.size(), [&](int i) {
+        return Edge{edges[i][0], edges[i][1], 0};
+    }, directed, false);
+}
+
+// Weighted edge list: edges[i] = {u, v, weight} (weighted = false drops the weights)
+// Takes a vector<Edge> or any contiguous array of Edge without copying it.
+inline CSRGraph buildCSR(int V, ArrayView<Edge> edges, bool directed = true, bool weighted = true) {
+    return buildCSRFrom(V, (int)edges.size(), [&](int i) {
+        return edges[i];
+    }, directed, weighted);
+}
+
+// Compact unweighted edge list: edges[i] = {u, v} (8 bytes per edge, no per-edge allocation)
+inline CSRGraph buildCSR(int V, ArrayView<EdgeUV> edges, bool directed = true) {
+    return buildCSRFrom(V, (int)edges.size(), [&](int i) {
+        return Edge{edges[i].u, edges[i].v, 0};
+    }, directed, false);
+}
+
+// Struct-of-arrays edge list (weighted if cols.w is not empty)
+inline CSRGraph buildCSR(int V, const EdgeColumns& cols, bool directed = true) {
+    bool weighted = !cols.w.empty();
+    return buildCSRFrom(V, (int)cols.size(), [&](int i) {
+        return Edge{cols.u[i], cols.v[i], weighted ? cols.w[i] : 0};
+    }, directed, weighted);
+}
+
+// Convert an existing adjacency list (adj[u] = {v1, v2, ...}) into CSR
+inline CSRGraph buildCSR(const vector<vector<int>>& adjList) {
+    CSRGraph g;
+    g.V = (int)adjList.size();
+    g.offsets.assign(g.V + 1, 0);
+    for (int u = 0; u < g.V; u++) {
+        g.offsets[u + 1] = g.offsets[u] + (int)adjList[u].size();
+    }
+    g.adj.reserve(g.offsets[g.V]);
+    for (auto& list : adjList) {
+        g.adj.append(list.begin(), list.end());
+    }
+    return g;
+}
+
+// Convert a weighted adjacency list (adj[u] = {(v, weight), ...}) into CSR
+inline CSRGraph buildCSR(const vector<vector<pair<int, int>>>& adjList) {
+    CSRGraph g;
+    g.V = (int)adjList.size();
+    g.offsets.assign(g.V + 1, 0);
+    for (int u = 0; u < g.V; u++) {
+        g.offsets[u + 1] = g.offsets[u] + (int)adjList[u].size();
+    }
+    g.adj.reserve(g.offsets[g.V]);
+    g.weights.reserve(g.offsets[g.V]);
+    for (auto& list : adjList) {
+        for (auto& edge : list) {
+            g.adj.push_back(edge.first);
+            g.weights.push_back(edge.second);
+        }
+    }
+    return g;
+}
+
+// Reverse every edge (u -> v becomes v -> u), i.e. the in-neighbor lists of g.
+// Needed by algorithms that look at a vertex's parents (bottom-up BFS, backward searches).
+inline CSRGraph transposeCSR(const CSRGraph& g) {
+    CSRGraph t;
+    t.V = g.V;
+    t.offsets.assign(g.V + 1, 0);
+
+    // Count in-degrees, then prefix sum → offsets of the reversed graph
+    for (int v : g.adj) t.offsets[v + 1]++;
+    for (int u = 0; u < g.V; u++) t.offsets[u + 1] += t.offsets[u];
+
+    t.adj.resize(g.numEdges());
+    if (g.isWeighted()) t.weights.resize(g.numEdges());
+
+    vector<int> cursor(t.offsets.begin(), t.offsets.end() - 1);
+    for (int u = 0; u < g.V; u++) {
+        for (int i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+            int pos = cursor[g.adj[i]]++;
+            t.adj[pos] = u;
+            if (g.isWeighted()) t.weights[pos] = g.weights[i];
+        }
+    }
+    return t;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Building from an edge list → O(V + E) (one counting pass + one fill pass)
+// Neighbors of u → O(1) to locate, O(deg(u)) to scan
+
+// 🧠 Space Complexity (SC):
+// offsets → V + 1 ints, adj → E ints, weights → E ints (only if weighted)
+// 👉 Total SC: O(V + E) with just 2–3 allocations
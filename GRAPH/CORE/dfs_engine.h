@@ -0,0 +1,193 @@
+// 🔁 Iterative (stack-safe) DFS engine
+// Recursive DFS uses one call-stack frame per vertex on the current path, so a path-like graph
+// with a few million vertices overflows the stack and crashes the process.
+// This engine keeps its own explicit stack of frames (vertex, next edge index; the parent is the frame below)
+// in a buffer allocated ONCE (size V, the deepest possible path), so depth is only limited by memory.
+
+// 🧠 Vertex states (classic white / gray / black coloring)
+// WHITE → not discovered yet
+// GRAY  → discovered, still on the DFS stack (its subtree is being explored)
+// BLACK → finished (all descendants explored)
+// An edge u -> v with v GRAY is a back edge → a cycle in a directed graph.
+
+// 🔧 Hooks (template parameters → the compiler inlines them, no virtual / function pointer calls)
+// discover(v, parent) → called when v turns GRAY  (pre-order),  parent = -1 for a root
+// finish(v)           → called when v turns BLACK (post-order)
+// backEdge(u, v)      → called for an edge u -> v where v is GRAY
+// Each hook returns true to continue or false to stop the whole search early.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include "csr_graph.h"
+using namespace std;
+
+enum DFSColor : char { WHITE = 0, GRAY = 1, BLACK = 2 };
+
+struct DFSFrame {
+    int v;       // Vertex of this frame
+    int edge;    // Next index into g.adj to look at
+};
+
+// Scratch memory for one DFS, reusable across calls on graphs with up to V vertices
+struct DFSWorkspace {
+    vector<char> state;       // WHITE / GRAY / BLACK per vertex
+    vector<DFSFrame> stack;   // Explicit DFS stack, never grows past V frames
+
+    void reset(int V) {
+        state.assign(V, WHITE);
+        if ((int)stack.size() < V) stack.resize(V);
+    }
+};
+
+// Workspace type used by the algorithms below for a given graph type
+// (other graph layouts, e.g. compressed_graph.h, provide their own frames + engine)
+template <typename Graph>
+struct DFSWorkspaceFor {
+    typedef DFSWorkspace type;
+};
+
+// Hook that does nothing (for callers that only need some of the hooks)
+struct NoDFSHook {
+    bool operator()(int) const { return true; }
+    bool operator()(int, int) const { return true; }
+};
+
+// DFS from one root over the WHITE vertices. Returns false if a hook stopped the search.
+template <typename Discover, typename Finish, typename BackEdge>
+bool dfsFrom(const CSRGraph& g, int root, DFSWorkspace& ws,
+             Discover&& discover, Finish&& finish, BackEdge&& backEdge) {
+    DFSFrame* stack = ws.stack.data();
+    int top = 0;
+
+    ws.state[root] = GRAY;
+    if (!discover(root, -1)) return false;
+    stack[top++] = {root, g.offsets[root]};
+
+    while (top > 0) {
+        DFSFrame& frame = stack[top - 1];
+
+        if (frame.edge < g.offsets[frame.v + 1]) {
+            // Look at the next edge of the vertex on top of the stack
+            int u = frame.v;
+            int to = g.adj[frame.edge++];
+
+            if (ws.state[to] == WHITE) {
+                ws.state[to] = GRAY;                          // Go one level deeper
+                if (!discover(to, u)) return false;
+                stack[top++] = {to, g.offsets[to]};
+            } else if (ws.state[to] == GRAY) {
+                if (!backEdge(u, to)) return false;           // Edge back into the current path
+            }
+        } else {
+            // All edges done → finish the vertex and pop it
+            ws.state[frame.v] = BLACK;
+            if (!finish(frame.v)) return false;
+            top--;
+        }
+    }
+
+    return true;
+}
+
+// DFS over the whole graph: start a new tree from every vertex that is still WHITE (0, 1, 2, ...)
+template <typename Discover, typename Finish, typename BackEdge>
+bool dfsForest(const CSRGraph& g, DFSWorkspace& ws,
+               Discover&& discover, Finish&& finish, BackEdge&& backEdge) {
+    ws.reset(g.V);
+    for (int root = 0; root < g.V; root++) {
+        if (ws.state[root] == WHITE && !dfsFrom(g, root, ws, discover, finish, backEdge))
+            return false;
+    }
+    return true;
+}
+
+
+// ✅ Algorithms built on the engine (any graph type with an engine: CSRGraph, CompressedGraph)
+
+// Pre-order DFS traversal starting from src (same order as the recursive version)
+template <typename Graph>
+vector<int> dfsOrder(const Graph& g, int src = 0) {
+    typename DFSWorkspaceFor<Graph>::type ws;
+    ws.reset(g.V);
+    vector<int> order;
+    dfsFrom(g, src, ws,
+            [&](int v, int) { order.push_back(v); return true; },
+            NoDFSHook(), NoDFSHook());
+    return order;
+}
+
+// Topological order = vertices in reverse finishing order.
+// Finished vertices are written straight into order[0 .. V) from the back, no extra stack.
+// Reentrant: all memory comes from the caller (workspace + output array), nothing is global,
+// so threads with their own workspace can run it at the same time. Once the workspace has
+// seen a graph this big, a call does not allocate at all.
+template <typename Graph, typename Workspace>
+void dfsTopoSort(const Graph& g, Workspace& ws, int* order) {
+    int pos = g.V;
+    dfsForest(g, ws, NoDFSHook(),
+              [&](int v) { order[--pos] = v; return true; },
+              NoDFSHook());
+}
+
+// Same, into a caller-owned vector (resized to V, which only allocates if it is too small)
+template <typename Graph, typename Workspace>
+void dfsTopoSort(const Graph& g, Workspace& ws, vector<int>& order) {
+    order.resize(g.V);
+    dfsTopoSort(g, ws, order.data());
+}
+
+// Convenience version with its own workspace and answer
+template <typename Graph>
+vector<int> dfsTopoSort(const Graph& g) {
+    typename DFSWorkspaceFor<Graph>::type ws;
+    vector<int> order;
+    dfsTopoSort(g, ws, order);
+    return order;
+}
+
+// Directed graph: a cycle exists iff DFS finds a back edge (edge into a GRAY vertex)
+template <typename Graph>
+bool hasDirectedCycle(const Graph& g) {
+    typename DFSWorkspaceFor<Graph>::type ws;
+    return !dfsForest(g, ws, NoDFSHook(), NoDFSHook(),
+                      [](int, int) { return false; });   // First back edge → stop
+}
+
+// Directed graph: the vertices of one cycle in edge order (c[0] -> c[1] -> ... -> c[0]), empty if none.
+// The first back edge u -> v closes the cycle v -> ... -> u on the current DFS path.
+template <typename Graph>
+vector<int> findDirectedCycle(const Graph& g) {
+    typename DFSWorkspaceFor<Graph>::type ws;
+    vector<int> parent(g.V, -1), cycle;
+    dfsForest(g, ws,
+              [&](int v, int p) { parent[v] = p; return true; },
+              NoDFSHook(),
+              [&](int u, int v) {
+                  for (int x = u; x != v; x = parent[x]) cycle.push_back(x);
+                  cycle.push_back(v);
+                  reverse(cycle.begin(), cycle.end());
+                  return false;
+              });
+    return cycle;
+}
+
+// Undirected graph (both directions stored): a GRAY neighbor other than the DFS parent closes a cycle
+template <typename Graph>
+bool hasUndirectedCycle(const Graph& g) {
+    typename DFSWorkspaceFor<Graph>::type ws;
+    vector<int> parent(g.V, -1);
+    return !dfsForest(g, ws,
+                      [&](int v, int p) { parent[v] = p; return true; },
+                      NoDFSHook(),
+                      [&](int u, int v) { return v == parent[u]; });   // Edge to parent is not a cycle
+}
+
+
+// ⏱ Time Complexity (TC):
+// Every vertex is pushed / popped once, every edge is looked at once → O(V + E)
+
+// 🧠 Space Complexity (SC):
+// state → V bytes, explicit stack → V frames (8 bytes each), allocated once
+// No recursion → call stack is O(1) no matter how deep the DFS goes
@@ -0,0 +1,175 @@
+// 🎲 Seeded synthetic graph generators (same seed → same graph, so runs are reproducible)
+// RMAT / Kronecker → skewed (power-law) degrees and small diameter, like social / web graphs.
+//   Each edge picks one quadrant of the adjacency matrix per bit of the vertex id
+//   with probabilities a, b, c, d (Graph500 uses 0.57, 0.19, 0.19, 0.05).
+// Grid → huge diameter, every vertex has degree <= 4, like road networks / meshes.
+// Random DAG → edges only go from a lower to a higher position of a hidden random order.
+// Long path → the worst case for recursion depth and for level-by-level algorithms.
+// Binary trees → traversals (preorder / inorder / postorder) of random or skewed trees.
+
+#pragma once
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "csr_graph.h"
+using namespace std;
+
+// Randomly rename the vertices (same graph, arbitrary ids, like ids coming from an external system)
+inline void shuffleLabels(int V, vector<Edge>& edges, unsigned seed) {
+    mt19937_64 rng(seed);
+    vector<int> perm(V);
+    for (int i = 0; i < V; i++) perm[i] = i;
+    shuffle(perm.begin(), perm.end(), rng);
+    for (auto& e : edges) {
+        e.u = perm[e.u];
+        e.v = perm[e.v];
+    }
+}
+
+// V = 2^scale vertices, E = edgeFactor * V edges, weights uniform in [1, maxWeight]
+inline vector<Edge> rmatEdges(int scale, int edgeFactor, unsigned seed = 1, int maxWeight = 1,
+                              double a = 0.57, double b = 0.19, double c = 0.19) {
+    mt19937_64 rng(seed);
+    uniform_real_distribution<double> coin(0.0, 1.0);
+    uniform_int_distribution<int> weight(1, maxWeight);
+
+    int V = 1 << scale;
+    long long E = (long long)edgeFactor * V;
+    vector<Edge> edges;
+    edges.reserve(E);
+
+    for (long long i = 0; i < E; i++) {
+        int u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = coin(rng);
+            if (r < a) {}                                   // Top-left: no bit set
+            else if (r < a + b) v |= 1 << bit;              // Top-right
+            else if (r < a + b + c) u |= 1 << bit;          // Bottom-left
+            else { u |= 1 << bit; v |= 1 << bit; }          // Bottom-right
+        }
+        edges.push_back({u, v, weight(rng)});
+    }
+
+    // Shuffle vertex ids so high-degree vertices are not all clustered near 0
+    shuffleLabels(V, edges, seed + 1);
+    return edges;
+}
+
+// rows x cols grid, edges go right and down (u < v in row-major order → the directed version is a DAG)
+// weights uniform in [1, maxWeight]
+inline vector<Edge> gridEdges(int rows, int cols, unsigned seed = 1, int maxWeight = 1) {
+    mt19937_64 rng(seed);
+    uniform_int_distribution<int> weight(1, maxWeight);
+
+    vector<Edge> edges;
+    edges.reserve(2LL * rows * cols);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int u = r * cols + c;
+            if (c + 1 < cols) edges.push_back({u, u + 1, weight(rng)});      // Right
+            if (r + 1 < rows) edges.push_back({u, u + cols, weight(rng)});   // Down
+        }
+    }
+    return edges;
+}
+
+// Random DAG: V vertices, E edges u -> v where u comes before v in a random topological order
+inline vector<Edge> randomDagEdges(int V, long long E, unsigned seed = 1, int maxWeight = 1) {
+    mt19937_64 rng(seed);
+    uniform_int_distribution<int> pick(0, V - 1), weight(1, maxWeight);
+
+    vector<Edge> edges;
+    edges.reserve(E);
+    while ((long long)edges.size() < E && V > 1) {
+        int a = pick(rng), b = pick(rng);
+        if (a == b) continue;
+        if (a > b) swap(a, b);
+        edges.push_back({a, b, weight(rng)});
+    }
+
+    shuffleLabels(V, edges, seed + 1);   // Hide the order: ids no longer tell which vertex comes first
+    return edges;
+}
+
+// Path 0 -> 1 -> ... -> V-1 with shuffled ids (deepest possible DFS, V BFS levels)
+inline vector<Edge> pathEdges(int V, unsigned seed = 1, int maxWeight = 1) {
+    mt19937_64 rng(seed);
+    uniform_int_distribution<int> weight(1, maxWeight);
+
+    vector<Edge> edges;
+    edges.reserve(V);
+    for (int v = 0; v + 1 < V; v++) edges.push_back({v, v + 1, weight(rng)});
+    shuffleLabels(V, edges, seed + 1);
+    return edges;
+}
+
+// The three traversals of a binary tree with distinct values 0 .. n-1
+struct TreeTraversals {
+    vector<int> preorder, inorder, postorder;
+};
+
+// Binary tree with n nodes. skewed = false → random BST shape (expected depth O(log n)),
+// skewed = true → every node has exactly one child, picked left or right at random (depth n).
+inline TreeTraversals randomTreeTraversals(int n, bool skewed, unsigned seed = 1) {
+    mt19937_64 rng(seed);
+    vector<int> left(n, -1), right(n, -1);
+    int root = n > 0 ? 0 : -1;
+
+    if (skewed) {
+        for (int v = 0; v + 1 < n; v++) {
+            if (rng() & 1) left[v] = v + 1;
+            else right[v] = v + 1;
+        }
+    } else if (n > 0) {
+        // Insert a random permutation into a BST: node ids are the keys
+        vector<int> keys(n);
+        for (int i = 0; i < n; i++) keys[i] = i;
+        shuffle(keys.begin(), keys.end(), rng);
+        root = keys[0];
+        for (int i = 1; i < n; i++) {
+            int cur = root, key = keys[i];
+            while (true) {
+                int& child = key < cur ? left[cur] : right[cur];
+                if (child == -1) { child = key; break; }
+                cur = child;
+            }
+        }
+    }
+
+    // Node values are a random permutation, so no traversal is simply sorted
+    vector<int> value(n);
+    for (int i = 0; i < n; i++) value[i] = i;
+    shuffle(value.begin(), value.end(), rng);
+
+    // Iterative traversals (the skewed tree is too deep for recursion)
+    TreeTraversals t;
+    vector<int> stack;
+    if (root != -1) stack.push_back(root);
+    while (!stack.empty()) {                         // Preorder: root, left, right
+        int v = stack.back();
+        stack.pop_back();
+        t.preorder.push_back(value[v]);
+        if (right[v] != -1) stack.push_back(right[v]);
+        if (left[v] != -1) stack.push_back(left[v]);
+    }
+
+    for (int v = root; v != -1 || !stack.empty();) {   // Inorder: left, root, right
+        while (v != -1) { stack.push_back(v); v = left[v]; }
+        v = stack.back();
+        stack.pop_back();
+        t.inorder.push_back(value[v]);
+        v = right[v];
+    }
+
+    if (root != -1) stack.push_back(root);
+    while (!stack.empty()) {                         // Postorder = reverse of (root, right, left)
+        int v = stack.back();
+        stack.pop_back();
+        t.postorder.push_back(value[v]);
+        if (left[v] != -1) stack.push_back(left[v]);
+        if (right[v] != -1) stack.push_back(right[v]);
+    }
+    reverse(t.postorder.begin(), t.postorder.end());
+    return t;
+}
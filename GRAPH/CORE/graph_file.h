@@ -0,0 +1,431 @@
+// 💾 Binary graph file format (.csr) + memory-mapped loader
+// Parsing a text edge list for every run is slow (tens of millions of lines → seconds).
+// Instead the CSR arrays are written ONCE to a binary file, exactly as they sit in memory,
+// and later opened with mmap: nothing is parsed or copied, pages are loaded lazily on first
+// access, and several processes opening the same file share the same physical pages.
+
+// 📄 Layout (version 1, little-endian, all arrays are 32-bit ints)
+//   [0, 64)   GraphFileHeader: magic "CSRGRAPH", version, flags (directed / weighted),
+//             vertex count, edge count, checksum of everything after the header
+//   offsets   (V + 1) ints
+//   adj       E ints
+//   weights   E ints (only if the weighted flag is set)
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "csr_graph.h"
+using namespace std;
+
+const uint32_t GRAPH_FILE_VERSION = 1;
+const uint32_t GRAPH_DIRECTED = 1;   // flags bit 0
+const uint32_t GRAPH_WEIGHTED = 2;   // flags bit 1
+
+struct GraphFileHeader {
+    char magic[8];          // "CSRGRAPH"
+    uint32_t version;       // GRAPH_FILE_VERSION
+    uint32_t flags;         // GRAPH_DIRECTED | GRAPH_WEIGHTED
+    uint64_t numVertices;
+    uint64_t numEdges;      // Stored (directed) edges = size of adj
+    uint64_t checksum;      // graphChecksum() of the payload
+    uint8_t reserved[24];   // Pads the header to 64 bytes (keeps the arrays aligned)
+};
+static_assert(sizeof(GraphFileHeader) == 64, "graph file header must be 64 bytes");
+
+// 64-bit FNV-1a style hash, 8 bytes per step (payload sizes are multiples of 4 bytes)
+inline uint64_t graphChecksum(const void* data, size_t bytes, uint64_t h = 1469598103934665603ULL) {
+    const unsigned char* p = (const unsigned char*)data;
+    size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t word;
+        memcpy(&word, p + i, 8);
+        h = (h ^ word) * 1099511628211ULL;
+    }
+    for (; i < bytes; i++) h = (h ^ p[i]) * 1099511628211ULL;
+    return h;
+}
+
+inline uint64_t graphChecksum(const CSRGraph& g) {
+    uint64_t h = graphChecksum(g.offsets.data(), g.offsets.size() * sizeof(int));
+    h = graphChecksum(g.adj.data(), g.adj.size() * sizeof(int), h);
+    if (g.isWeighted()) h = graphChecksum(g.weights.data(), g.weights.size() * sizeof(int), h);
+    return h;
+}
+
+// Write g to a .csr file. Returns false and sets `error` on failure.
+inline bool writeGraphFile(const string& path, const CSRGraph& g, bool directed, string& error) {
+    GraphFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "CSRGRAPH", 8);
+    header.version = GRAPH_FILE_VERSION;
+    header.flags = (directed ? GRAPH_DIRECTED : 0) | (g.isWeighted() ? GRAPH_WEIGHTED : 0);
+    header.numVertices = g.V;
+    header.numEdges = g.numEdges();
+    header.checksum = graphChecksum(g);
+
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) {
+        error = "cannot create " + path;
+        return false;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+           && fwrite(g.offsets.data(), sizeof(int), g.offsets.size(), f) == g.offsets.size()
+           && fwrite(g.adj.data(), sizeof(int), g.adj.size(), f) == g.adj.size();
+    if (ok && g.isWeighted()) {
+        ok = fwrite(g.weights.data(), sizeof(int), g.weights.size(), f) == g.weights.size();
+    }
+    ok = (fclose(f) == 0) && ok;
+
+    if (!ok) error = "write failed for " + path;
+    return ok;
+}
+
+// How much of a .csr file MappedGraph::open checks before handing out the graph
+enum GraphFileCheck {
+    CHECK_GRAPH,        // Header + offsets + every neighbor id in [0, V) (default), O(V + E)
+    CHECK_CHECKSUM,     // CHECK_GRAPH + checksum of the whole payload
+    TRUST_ADJACENCY,    // Header + offsets only, O(V): explicit opt-in for trusted files
+};
+
+// Read-only graph backed by a memory-mapped .csr file
+class MappedGraph {
+public:
+    MappedGraph() {}
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+    ~MappedGraph() { close(); }
+
+    // Map the file and point the CSR arrays into it. By default the header (magic, version, sizes),
+    // the offsets array (offsets[0] == 0, non-decreasing, offsets[V] == E) and every neighbor id
+    // (in [0, V)) are checked, O(V + E), so no algorithm can index outside its arrays.
+    // CHECK_CHECKSUM also hashes the payload. TRUST_ADJACENCY skips reading adj (O(V), the file's
+    // pages are only touched later by the algorithms): only for files this program wrote itself.
+    bool open(const string& path, string& error, GraphFileCheck check = CHECK_GRAPH) {
+        close();
+        error.clear();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            error = "cannot open " + path;
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(GraphFileHeader)) {
+            ::close(fd);
+            error = path + " is too small to be a graph file";
+            return false;
+        }
+
+        length = st.st_size;
+        base = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);   // The mapping stays valid after the descriptor is closed
+        if (base == MAP_FAILED) {
+            base = nullptr;
+            error = "mmap failed for " + path;
+            return false;
+        }
+
+        memcpy(&hdr, base, sizeof(hdr));
+        uint64_t arrays = (hdr.numVertices + 1) + hdr.numEdges * (hdr.flags & GRAPH_WEIGHTED ? 2 : 1);
+        if (memcmp(hdr.magic, "CSRGRAPH", 8) != 0) {
+            error = path + " is not a CSR graph file";
+        } else if (hdr.version != GRAPH_FILE_VERSION) {
+            error = path + " has unsupported version " + to_string(hdr.version);
+        } else if (hdr.numVertices > INT32_MAX || hdr.numEdges > INT32_MAX
+                   || length != sizeof(GraphFileHeader) + arrays * sizeof(int)) {
+            error = path + " has inconsistent sizes (truncated or corrupt)";
+        }
+        if (!error.empty()) {
+            close();
+            return false;
+        }
+
+        const int* data = (const int*)((const char*)base + sizeof(GraphFileHeader));
+        g.V = (int)hdr.numVertices;
+        g.offsets.borrow(data, hdr.numVertices + 1);
+        g.adj.borrow(data + hdr.numVertices + 1, hdr.numEdges);
+        if (hdr.flags & GRAPH_WEIGHTED) g.weights.borrow(data + hdr.numVertices + 1 + hdr.numEdges, hdr.numEdges);
+        else g.weights.borrow(nullptr, 0);
+
+        if (!validOffsets()) {
+            error = path + " has corrupt offsets (not a valid CSR graph)";
+        } else if (check != TRUST_ADJACENCY && !validAdjacency()) {
+            error = path + " has neighbor ids outside [0, V)";
+        } else if (check == CHECK_CHECKSUM && graphChecksum(g) != hdr.checksum) {
+            error = path + " failed the checksum";
+        }
+        if (!error.empty()) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (base) munmap(base, length);
+        base = nullptr;
+        length = 0;
+        g = CSRGraph();
+    }
+
+    const CSRGraph& graph() const { return g; }
+    const GraphFileHeader& header() const { return hdr; }
+    bool directed() const { return hdr.flags & GRAPH_DIRECTED; }
+    bool weighted() const { return hdr.flags & GRAPH_WEIGHTED; }
+
+private:
+    bool validOffsets() const {
+        if (g.offsets[0] != 0 || g.offsets[g.V] != (int)hdr.numEdges) return false;
+        for (int v = 0; v < g.V; v++) {
+            if (g.offsets[v] > g.offsets[v + 1]) return false;
+        }
+        return true;
+    }
+
+    bool validAdjacency() const {
+        for (int w : g.adj) {
+            if (w < 0 || w >= g.V) return false;
+        }
+        return true;
+    }
+
+    void* base = nullptr;
+    size_t length = 0;
+    GraphFileHeader hdr = {};
+    CSRGraph g;
+};
+
+// 📥 Streaming text edge-list reader: one "u v" (or "u v w" when weighted) per line,
+// lines starting with '#' or '%' are comments.
+// The file is read through a fixed-size buffer and parsed into caller-owned chunks of edges,
+// so memory stays O(chunk) no matter how long the file is:
+//   EdgeListReader in;
+//   vector<EdgeUV> chunk(1 << 20);
+//   while (size_t n = in.read(chunk.data(), chunk.size())) process(ArrayView<EdgeUV>(chunk.data(), n));
+//   if (!in.ok()) → in.error()
+class EdgeListReader {
+public:
+    ~EdgeListReader() { close(); }
+
+    bool open(const string& path, bool weighted, string& error, size_t bufferBytes = 1 << 20) {
+        close();
+        file = fopen(path.c_str(), "rb");
+        if (!file) {
+            error = "cannot open " + path;
+            return false;
+        }
+        this->path = path;
+        this->weighted = weighted;
+        buffer.resize(max<size_t>(bufferBytes, 256));
+        rewind();
+        return true;
+    }
+
+    // Start over from the first line (for two-pass consumers such as buildCSRFromEdgeFile)
+    void rewind() {
+        if (file) fseek(file, 0, SEEK_SET);
+        head = tail = 0;
+        atEof = false;
+        lineNo = 0;
+        maxId = -1;
+        errorText.clear();
+    }
+
+    void close() {
+        if (file) fclose(file);
+        file = nullptr;
+    }
+
+    // Fill out[0 .. n) with the next edges, n ≤ capacity. Returns 0 at the end of the file or on error.
+    size_t read(Edge* out, size_t capacity) {
+        return readInto(capacity, [&](size_t i, int u, int v, int w) { out[i] = {u, v, w}; });
+    }
+    size_t read(EdgeUV* out, size_t capacity) {
+        return readInto(capacity, [&](size_t i, int u, int v, int) { out[i] = {u, v}; });
+    }
+
+    int numVertices() const { return maxId + 1; }   // Largest id seen so far + 1
+    bool ok() const { return errorText.empty(); }
+    const string& error() const { return errorText; }
+
+private:
+    template <typename Store>
+    size_t readInto(size_t capacity, Store store) {
+        size_t n = 0;
+        const char* p;
+        const char* end;
+        while (n < capacity && ok() && nextLine(p, end)) {
+            lineNo++;
+            while (p < end && (*p == ' ' || *p == '\t')) p++;
+            if (p == end || *p == '#' || *p == '%' || *p == '\r') continue;
+
+            long long u, v, w = 1;
+            if (!parseInt(p, end, u)) return fail("expected vertex id");
+            if (!parseInt(p, end, v)) return fail("expected second vertex id");
+            if (weighted && !parseInt(p, end, w)) return fail("expected weight");
+            if (u < 0 || v < 0 || u >= INT32_MAX || v >= INT32_MAX) return fail("vertex id out of range");
+            if (w < INT32_MIN || w > INT32_MAX) return fail("weight out of range");
+
+            store(n++, (int)u, (int)v, (int)w);
+            maxId = max(maxId, (int)max(u, v));
+        }
+        return n;
+    }
+
+    // [p, end) = next line without its '\n'; refills the buffer when the line is not complete
+    bool nextLine(const char*& p, const char*& end) {
+        while (true) {
+            char* newline = (char*)memchr(buffer.data() + head, '\n', tail - head);
+            if (newline || (atEof && head < tail)) {
+                p = buffer.data() + head;
+                end = newline ? newline : buffer.data() + tail;
+                head = newline ? newline - buffer.data() + 1 : tail;
+                return true;
+            }
+            if (atEof) return false;
+
+            // Move the unfinished line to the front and read more behind it
+            memmove(buffer.data(), buffer.data() + head, tail - head);
+            tail -= head;
+            head = 0;
+            if (tail == buffer.size()) buffer.resize(buffer.size() * 2);   // Line longer than the buffer
+            size_t got = fread(buffer.data() + tail, 1, buffer.size() - tail, file);
+            tail += got;
+            if (got == 0) atEof = true;
+        }
+    }
+
+    static bool parseInt(const char*& p, const char* end, long long& x) {
+        while (p < end && (*p == ' ' || *p == '\t')) p++;
+        bool negative = p < end && *p == '-';
+        if (negative) p++;
+        if (p == end || *p < '0' || *p > '9') return false;
+        x = 0;
+        for (; p < end && *p >= '0' && *p <= '9'; p++) {
+            if (x < INT64_MAX / 10 - 10) x = x * 10 + (*p - '0');   // Saturates → "out of range" below
+        }
+        if (negative) x = -x;
+        return true;
+    }
+
+    size_t fail(const string& what) {
+        errorText = path + ":" + to_string(lineNo) + ": " + what;
+        return 0;
+    }
+
+    FILE* file = nullptr;
+    string path, errorText;
+    bool weighted = false, atEof = false;
+    vector<char> buffer;
+    size_t head = 0, tail = 0;   // Unparsed bytes are buffer[head .. tail)
+    long long lineNo = 0;
+    int maxId = -1;
+};
+
+// Parse a whole text edge list into memory. V = largest id + 1.
+inline bool readEdgeListText(const string& path, bool weighted, int& V, vector<Edge>& edges, string& error) {
+    EdgeListReader in;
+    if (!in.open(path, weighted, error)) return false;
+
+    edges.clear();
+    vector<Edge> chunk(1 << 16);
+    while (size_t n = in.read(chunk.data(), chunk.size())) edges.insert(edges.end(), chunk.begin(), chunk.begin() + n);
+    if (!in.ok()) {
+        error = in.error();
+        return false;
+    }
+    V = in.numVertices();
+    return true;
+}
+
+// Build a CSR graph straight from a text edge list in two streaming passes
+// (count degrees, then fill), so the edge list itself is never held in memory:
+// peak memory = the CSR arrays + one chunk of chunkEdges edges.
+inline bool buildCSRFromEdgeFile(const string& path, bool directed, bool weighted, CSRGraph& g,
+                                 string& error, size_t chunkEdges = 1 << 16) {
+    EdgeListReader in;
+    if (!in.open(path, weighted, error)) return false;
+    vector<Edge> chunk(chunkEdges);
+
+    // Pass 1: degrees (the vertex count is only known at the end, so the array grows as needed)
+    vector<int> degree;
+    while (size_t n = in.read(chunk.data(), chunk.size())) {
+        if ((int)degree.size() < in.numVertices()) degree.resize(max((size_t)in.numVertices(), degree.size() * 2));
+        for (size_t i = 0; i < n; i++) {
+            degree[chunk[i].u]++;
+            if (!directed) degree[chunk[i].v]++;
+        }
+    }
+    if (!in.ok()) {
+        error = in.error();
+        return false;
+    }
+
+    g = CSRGraph();
+    g.V = in.numVertices();
+    g.offsets.assign(g.V + 1, 0);
+    for (int u = 0; u < g.V; u++) g.offsets[u + 1] = g.offsets[u] + degree[u];
+    g.adj.resize(g.offsets[g.V]);
+    if (weighted) g.weights.resize(g.offsets[g.V]);
+
+    // Pass 2: same edge order as buildCSR, so both give identical graphs.
+    // A list that fills up early means the file changed since pass 1: stop before writing out of bounds.
+    vector<int> cursor(g.offsets.begin(), g.offsets.end() - 1);
+    auto put = [&](int from, int to, int weight) {
+        if (cursor[from] == g.offsets[from + 1]) return false;
+        int pos = cursor[from]++;
+        g.adj[pos] = to;
+        if (weighted) g.weights[pos] = weight;
+        return true;
+    };
+    bool changed = false;
+    in.rewind();
+    while (size_t n = in.read(chunk.data(), chunk.size())) {
+        for (size_t i = 0; i < n; i++) {
+            const Edge& e = chunk[i];
+            if (e.u >= g.V || e.v >= g.V || !put(e.u, e.v, e.weight) || (!directed && !put(e.v, e.u, e.weight))) {
+                changed = true;
+                break;
+            }
+        }
+        if (changed) break;
+    }
+    if (!in.ok() || changed || in.numVertices() != g.V) {
+        error = !in.ok() ? in.error() : path + " changed while it was being read";
+        g = CSRGraph();
+        return false;
+    }
+    return true;
+}
+
+// One-time conversion: text edge list → .csr file
+inline bool convertTextToGraphFile(const string& textPath, const string& outPath,
+                                   bool directed, bool weighted, string& error) {
+    int V;
+    vector<Edge> edges;
+    if (!readEdgeListText(textPath, weighted, V, edges, error)) return false;
+    return writeGraphFile(outPath, buildCSR(V, edges, directed, weighted), directed, error);
+}
+
+
+// ⏱ Time Complexity (TC):
+// Conversion → O(V + E) parse + build + write (done once)
+// open() → one mmap call + O(V) offsets check + O(E) neighbor id check (CHECK_CHECKSUM: + O(V + E) hash;
+// TRUST_ADJACENCY: O(V) only, adj pages are then read on first touch)
+
+// 🧠 Space Complexity (SC):
+// File size = 64 + 4 * (V + 1 + E [+ E]) bytes
+// EdgeListReader → one text buffer + the caller's chunk, independent of the file size
+// Mapped pages live in the shared page cache, not in the process heap
@@ -0,0 +1,157 @@
+// 🧵 Small parallel toolkit shared by the parallel graph algorithms
+// ThreadPool → a fixed team of worker threads that all run the same job(tid) (SPMD style).
+//              Threads are created once and reused for every call to run().
+// Barrier    → every thread waits until the whole team reaches the same point
+//              (used between the levels of level-synchronous algorithms).
+// ChunkQueue → hands out [begin, end) chunks of a range through one atomic counter,
+//              so fast threads simply take more chunks (dynamic load balancing).
+
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+using namespace std;
+
+class Barrier {
+public:
+    explicit Barrier(int count) : count(count), waiting(0), generation(0) {}
+
+    // Block until `count` threads have called wait()
+    void wait() {
+        unique_lock<mutex> lock(m);
+        int gen = generation;
+        if (++waiting == count) {
+            waiting = 0;          // Last thread to arrive releases everybody
+            generation++;
+            cv.notify_all();
+        } else {
+            cv.wait(lock, [&] { return gen != generation; });
+        }
+    }
+
+private:
+    mutex m;
+    condition_variable cv;
+    int count, waiting, generation;
+};
+
+class ThreadPool {
+public:
+    explicit ThreadPool(int numThreads = (int)thread::hardware_concurrency())
+        : numThreads(max(1, numThreads)) {
+        // Thread 0 is the caller of run(), so only numThreads - 1 workers are spawned
+        for (int tid = 1; tid < this->numThreads; tid++) {
+            workers.emplace_back([this, tid] { workerLoop(tid); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(m);
+            stop = true;
+        }
+        startCv.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+    int size() const { return numThreads; }
+
+    // Run job(tid) on every thread of the team (tid = 0 .. size() - 1) and wait for all of them
+    void run(const function<void(int)>& job) {
+        {
+            lock_guard<mutex> lock(m);
+            currentJob = &job;
+            pending = numThreads - 1;
+            round++;
+        }
+        startCv.notify_all();
+
+        job(0);   // The calling thread works too
+
+        unique_lock<mutex> lock(m);
+        doneCv.wait(lock, [&] { return pending == 0; });
+        currentJob = nullptr;
+    }
+
+private:
+    void workerLoop(int tid) {
+        long long seenRound = 0;
+        while (true) {
+            const function<void(int)>* job;
+            {
+                unique_lock<mutex> lock(m);
+                startCv.wait(lock, [&] { return stop || round != seenRound; });
+                if (stop) return;
+                seenRound = round;
+                job = currentJob;
+            }
+
+            (*job)(tid);
+
+            lock_guard<mutex> lock(m);
+            if (--pending == 0) doneCv.notify_one();
+        }
+    }
+
+    int numThreads;
+    vector<thread> workers;
+    mutex m;
+    condition_variable startCv, doneCv;
+    const function<void(int)>* currentJob = nullptr;
+    long long round = 0;
+    int pending = 0;
+    bool stop = false;
+};
+
+// Hands out chunks of [0, n) to whichever thread asks first
+struct ChunkQueue {
+    atomic<long long> next{0};
+    long long n = 0;
+    int chunk = 64;
+
+    void reset(long long size, int chunkSize = 64) {
+        n = size;
+        chunk = chunkSize;
+        next.store(0, memory_order_relaxed);
+    }
+
+    // Returns false when the range is exhausted
+    bool grab(long long& begin, long long& end) {
+        begin = next.fetch_add(chunk, memory_order_relaxed);
+        if (begin >= n) return false;
+        end = min(n, begin + chunk);
+        return true;
+    }
+};
+
+// Lock-free merge of per-thread buffers into one array:
+// thread tid copies local[tid] to out[mergeOffset(local, tid) ...], slices never overlap.
+// out must first be resized to mergeSize(local) (by one thread, followed by a barrier).
+template <typename T>
+size_t mergeOffset(const vector<vector<T>>& local, int tid) {
+    size_t offset = 0;
+    for (int t = 0; t < tid; t++) offset += local[t].size();
+    return offset;
+}
+
+template <typename T>
+size_t mergeSize(const vector<vector<T>>& local) {
+    size_t total = 0;
+    for (auto& buf : local) total += buf.size();
+    return total;
+}
+
+// Atomic min for distances (CAS loop), returns true if `value` became the new minimum
+template <typename T>
+bool atomicMin(atomic<T>& target, T value) {
+    T current = target.load(memory_order_relaxed);
+    while (value < current) {
+        if (target.compare_exchange_weak(current, value, memory_order_relaxed)) return true;
+    }
+    return false;
+}
@@ -0,0 +1,230 @@
+// 🗺️ Vertex reordering (relabeling) for cache locality
+// Graph algorithms touch dist[v], vis[v], adj[v] for the neighbors v of the current node.
+// If neighbors have ids far apart, every access is a cache miss. Renaming the vertices so that
+// vertices used together get nearby ids makes those arrays behave like sequential memory.
+
+// 🧠 Orderings offered
+// Degree sort → high-degree vertices first (the "hot" vertices share a few cache lines)
+// BFS order   → ids given in BFS visiting order, neighbors end up close to each other
+// RCM         → Reverse Cuthill-McKee: BFS from a low-degree vertex, neighbors visited by increasing
+//               degree, whole order reversed → small bandwidth (great for meshes / road graphs)
+// Gorder      → greedy: next id goes to the vertex sharing the most edges / common in-neighbors
+//               with the last `window` placed vertices (simplified, huge hubs are skipped)
+
+// The result keeps BOTH maps, so answers computed on the relabeled graph are mapped back
+// to the original ids with toOriginal().
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <cmath>
+#include <algorithm>
+#include "csr_graph.h"
+using namespace std;
+
+struct Reordering {
+    vector<int> newId;   // newId[original] = label in the reordered graph
+    vector<int> oldId;   // oldId[label] = original id (inverse map)
+
+    // Per-vertex results computed on the reordered graph → indexed by original id
+    template <typename T>
+    vector<T> toOriginal(const vector<T>& byNewId) const {
+        vector<T> out(byNewId.size());
+        for (int old = 0; old < (int)newId.size(); old++) out[old] = byNewId[newId[old]];
+        return out;
+    }
+
+    // A list of vertices (traversal order, path, ...) → original ids
+    vector<int> verticesToOriginal(const vector<int>& vertices) const {
+        vector<int> out(vertices.size());
+        for (int i = 0; i < (int)vertices.size(); i++) out[i] = oldId[vertices[i]];
+        return out;
+    }
+};
+
+// order[i] = original id that gets label i
+inline Reordering reorderingFromOrder(const vector<int>& order) {
+    Reordering r;
+    r.oldId = order;
+    r.newId.assign(order.size(), -1);
+    for (int i = 0; i < (int)order.size(); i++) r.newId[order[i]] = i;
+    return r;
+}
+
+// Build the relabeled graph; each neighbor list is sorted by new id (and keeps its weights)
+inline CSRGraph relabel(const CSRGraph& g, const Reordering& r) {
+    CSRGraph h;
+    h.V = g.V;
+    h.offsets.assign(g.V + 1, 0);
+    for (int label = 0; label < g.V; label++) {
+        h.offsets[label + 1] = h.offsets[label] + g.degree(r.oldId[label]);
+    }
+    h.adj.resize(g.numEdges());
+    if (g.isWeighted()) h.weights.resize(g.numEdges());
+
+    vector<pair<int, int>> list;   // (new neighbor id, weight) of one vertex
+    for (int label = 0; label < g.V; label++) {
+        int u = r.oldId[label];
+        list.clear();
+        for (int i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+            list.push_back({r.newId[g.adj[i]], g.isWeighted() ? g.weights[i] : 0});
+        }
+        sort(list.begin(), list.end());
+
+        int pos = h.offsets[label];
+        for (auto& e : list) {
+            h.adj[pos] = e.first;
+            if (g.isWeighted()) h.weights[pos] = e.second;
+            pos++;
+        }
+    }
+    return h;
+}
+
+// Highest degree first (ties keep the original order)
+inline Reordering degreeSortOrder(const CSRGraph& g) {
+    vector<int> order(g.V);
+    for (int v = 0; v < g.V; v++) order[v] = v;
+    stable_sort(order.begin(), order.end(), [&](int a, int b) { return g.degree(a) > g.degree(b); });
+    return reorderingFromOrder(order);
+}
+
+// BFS visiting order, one BFS per component (components started in id order)
+inline Reordering bfsReorder(const CSRGraph& g) {
+    vector<int> order;
+    order.reserve(g.V);
+    vector<char> vis(g.V, 0);
+
+    for (int start = 0; start < g.V; start++) {
+        if (vis[start]) continue;
+        vis[start] = 1;
+        size_t head = order.size();
+        order.push_back(start);
+
+        // `order` itself is the BFS queue
+        while (head < order.size()) {
+            int node = order[head++];
+            for (int neighbor : g.neighbors(node)) {
+                if (!vis[neighbor]) {
+                    vis[neighbor] = 1;
+                    order.push_back(neighbor);
+                }
+            }
+        }
+    }
+    return reorderingFromOrder(order);
+}
+
+// Reverse Cuthill-McKee (meant for undirected graphs; on a directed graph it follows out-edges)
+inline Reordering rcmOrder(const CSRGraph& g) {
+    // Components are started from their lowest-degree vertex (cheap peripheral-vertex guess)
+    vector<int> starts(g.V);
+    for (int v = 0; v < g.V; v++) starts[v] = v;
+    stable_sort(starts.begin(), starts.end(), [&](int a, int b) { return g.degree(a) < g.degree(b); });
+
+    vector<int> order;
+    order.reserve(g.V);
+    vector<char> vis(g.V, 0);
+    vector<int> fresh;   // Newly found neighbors of one node, sorted by degree before enqueueing
+
+    for (int start : starts) {
+        if (vis[start]) continue;
+        vis[start] = 1;
+        size_t head = order.size();
+        order.push_back(start);
+
+        while (head < order.size()) {
+            int node = order[head++];
+            fresh.clear();
+            for (int neighbor : g.neighbors(node)) {
+                if (!vis[neighbor]) {
+                    vis[neighbor] = 1;
+                    fresh.push_back(neighbor);
+                }
+            }
+            sort(fresh.begin(), fresh.end(), [&](int a, int b) { return g.degree(a) < g.degree(b); });
+            order.insert(order.end(), fresh.begin(), fresh.end());
+        }
+    }
+
+    reverse(order.begin(), order.end());
+    return reorderingFromOrder(order);
+}
+
+// Simplified Gorder (Wei et al.): greedily append the vertex with the highest score, where
+// score(v) = edges between v and the last `window` placed vertices
+//          + common in-neighbors with them (hubs with degree > hubCap are skipped)
+inline Reordering gorderOrder(const CSRGraph& g, int window = 5) {
+    int V = g.V;
+    CSRGraph inG = transposeCSR(g);
+    int hubCap = max(16, (int)sqrt((double)V));
+
+    vector<int> score(V, 0);
+    vector<char> placed(V, 0);
+    priority_queue<pair<int, int>> pq;   // (score, vertex), stale entries are skipped lazily
+    vector<int> order;
+    order.reserve(V);
+
+    auto bump = [&](int x, int delta) {
+        if (placed[x]) return;
+        score[x] += delta;
+        if (delta > 0) pq.push({score[x], x});
+    };
+
+    // Vertex u enters (+1) or leaves (-1) the window
+    auto update = [&](int u, int delta) {
+        for (int x : g.neighbors(u)) bump(x, delta);          // u -> x
+        bool hub = inG.degree(u) > hubCap;                     // Siblings of a hub are skipped
+        for (int p : inG.neighbors(u)) {
+            bump(p, delta);                                    // p -> u
+            if (hub || g.degree(p) > hubCap) continue;
+            for (int x : g.neighbors(p)) {
+                if (x != u) bump(x, delta);                    // p -> u and p -> x: common in-neighbor
+            }
+        }
+    };
+
+    // Start from the vertex with the largest in-degree
+    int first = 0;
+    for (int v = 1; v < V; v++) {
+        if (inG.degree(v) > inG.degree(first)) first = v;
+    }
+
+    int scan = 0;   // Fallback: next unplaced vertex in id order
+    for (int k = 0; k < V; k++) {
+        int v = -1;
+        if (k == 0) {
+            v = first;
+        } else {
+            while (!pq.empty()) {
+                auto top = pq.top();
+                pq.pop();
+                if (placed[top.second]) continue;
+                if (top.first == score[top.second]) { v = top.second; break; }
+                if (score[top.second] < top.first) pq.push({score[top.second], top.second});   // Was decreased
+            }
+            if (v == -1) {
+                while (placed[scan]) scan++;
+                v = scan;
+            }
+        }
+
+        placed[v] = 1;
+        order.push_back(v);
+        update(v, +1);
+        if (k >= window) update(order[k - window], -1);
+    }
+
+    return reorderingFromOrder(order);
+}
+
+
+// ⏱ Time Complexity (TC):
+// Degree sort → O(V log V), BFS order → O(V + E), RCM → O(V + E + E log(max degree))
+// Gorder (simplified) → O(sum over v of deg(v) * capped in-neighbor degrees * log) — the slowest,
+//                       but usually gives the best locality
+// relabel → O(V + E log(max degree)) (neighbor lists are re-sorted)
+
+// 🧠 Space Complexity (SC):
+// Both maps → 2 * V ints, relabeled graph → O(V + E)
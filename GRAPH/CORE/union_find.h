@@ -0,0 +1,163 @@
+// 🔗 Union-Find (Disjoint Set Union) for streamed undirected edges
+// Every vertex starts in its own set. For each edge (u, v):
+//   find(u) == find(v) → u and v are already connected, so this edge closes a CYCLE
+//   otherwise          → union the two sets (one fewer connected component)
+// One pass over the edges, no adjacency list, O(V) memory → works on edge streams of any length.
+
+// 🧠 Two versions
+// DisjointSet           → single thread: union by size + path compression
+//                         (amortized almost O(1) per operation: inverse Ackermann)
+// ConcurrentDisjointSet → many ingest threads at once, lock-free:
+//                         parent pointers are atomics, a root is linked with compare-and-swap
+//                         (the CAS fails if another thread changed that root first → retry),
+//                         find() shortens paths with CAS path halving.
+//                         Roots are linked by a fixed pseudo-random priority instead of size
+//                         (a size cannot be updated atomically together with the link),
+//                         which keeps trees shallow in expectation.
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <climits>
+#include "csr_graph.h"
+using namespace std;
+
+class DisjointSet {
+public:
+    explicit DisjointSet(int V = 0) { reset(V); }
+
+    void reset(int V) {
+        parent.resize(V);
+        size.assign(V, 1);
+        for (int v = 0; v < V; v++) parent[v] = v;
+        components = V;
+    }
+
+    // Root of v's set; every vertex on the way is re-pointed straight at the root
+    int find(int v) {
+        int root = v;
+        while (parent[root] != root) root = parent[root];
+        while (parent[v] != root) {
+            int next = parent[v];
+            parent[v] = root;
+            v = next;
+        }
+        return root;
+    }
+
+    // Returns false if a and b were already in the same set (the edge a - b closes a cycle)
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (size[a] < size[b]) swap(a, b);   // Smaller tree goes under the bigger one
+        parent[b] = a;
+        size[a] += size[b];
+        components--;
+        return true;
+    }
+
+    bool sameSet(int a, int b) { return find(a) == find(b); }
+    int numComponents() const { return components; }
+    int setSize(int v) { return size[find(v)]; }
+
+private:
+    vector<int> parent, size;
+    int components = 0;
+};
+
+class ConcurrentDisjointSet {
+public:
+    explicit ConcurrentDisjointSet(int V) : parent(V), components(V) {
+        for (int v = 0; v < V; v++) parent[v].store(v, memory_order_relaxed);
+    }
+
+    int find(int v) {
+        while (true) {
+            int p = parent[v].load(memory_order_acquire);
+            if (p == v) return v;
+            int gp = parent[p].load(memory_order_acquire);
+            if (gp != p) {
+                // Path halving: point v at its grandparent (harmless if another thread got there first)
+                parent[v].compare_exchange_weak(p, gp, memory_order_release, memory_order_relaxed);
+            }
+            v = gp;
+        }
+    }
+
+    // Lock-free union. Returns false if a and b were already connected (the edge closes a cycle).
+    bool unite(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (lower(b, a)) swap(a, b);     // a = root with the lower priority, goes under b
+
+            int expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, memory_order_acq_rel)) {
+                components.fetch_sub(1, memory_order_relaxed);
+                return true;
+            }
+            // a stopped being a root meanwhile (someone linked it) → look again
+        }
+    }
+
+    // Linearizable while other threads keep uniting: a != b can only be trusted if a is still a root
+    bool sameSet(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return true;
+            if (parent[a].load(memory_order_acquire) == a) return false;
+        }
+    }
+
+    int numComponents() const { return components.load(memory_order_relaxed); }
+
+private:
+    // Fixed pseudo-random total order on vertices (hash, ties broken by id)
+    static uint32_t priority(int v) {
+        uint32_t x = (uint32_t)v * 0x9E3779B1u;
+        x ^= x >> 16;
+        x *= 0x85EBCA6Bu;
+        return x ^ (x >> 13);
+    }
+    static bool lower(int a, int b) {
+        uint32_t pa = priority(a), pb = priority(b);
+        return pa < pb || (pa == pb && a < b);
+    }
+
+    vector<atomic<int>> parent;
+    atomic<int> components;
+};
+
+// Index of the first edge (in stream order) that closes a cycle, -1 if the edges form a forest
+template <typename EdgeType>
+long long firstCycleEdgeIn(int V, ArrayView<EdgeType> edges) {
+    DisjointSet ds(V);
+    for (size_t i = 0; i < edges.size(); i++) {
+        if (!ds.unite(edges[i].u, edges[i].v)) return (long long)i;
+    }
+    return -1;
+}
+
+inline long long firstCycleEdge(int V, ArrayView<Edge> edges) { return firstCycleEdgeIn(V, edges); }
+inline long long firstCycleEdge(int V, ArrayView<EdgeUV> edges) { return firstCycleEdgeIn(V, edges); }
+inline long long firstCycleEdge(int V, const EdgeColumns& edges) {
+    DisjointSet ds(V);
+    for (size_t i = 0; i < edges.size(); i++) {
+        if (!ds.unite(edges.u[i], edges.v[i])) return (long long)i;
+    }
+    return -1;
+}
+
+
+// ⏱ Time Complexity (TC):
+// DisjointSet → O(α(V)) amortized per find / unite (α = inverse Ackermann, ≤ 4 in practice)
+// ConcurrentDisjointSet → expected O(log V) per operation without contention,
+//                         plus a retry for every CAS lost to another thread
+
+// 🧠 Space Complexity (SC):
+// O(V): one parent (+ size) entry per vertex, independent of the number of edges
@@ -0,0 +1,174 @@
+// 🗺️ Vertex Reordering for Cache Locality
+// Vertex ids often come from an external system in arbitrary order, so the neighbors of a node
+// are scattered all over dist[], vis[] and the adjacency array → almost every access is a cache miss.
+// A preprocessing pass renames the vertices (degree sort, BFS order, RCM, Gorder — see CORE/reorder.h),
+// the algorithms run on the relabeled graph, and the results are mapped back to the original ids.
+
+// 🧠 Steps
+// 1. Compute a permutation: newId[old] and its inverse oldId[new].
+// 2. Relabel the graph once (CSR with neighbor lists sorted by the new ids).
+// 3. Translate the query (source = newId[source]), run the algorithm.
+// 4. Translate the answer back (dist[old] = distNew[newId[old]], vertex lists through oldId).
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <chrono>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+#include "../CORE/reorder.h"
+#include "../CORE/perf_counter.h"
+#include "../CORE/dfs_engine.h"
+#include "../BFS_DFS/bfs.h"
+#include "../SHORTEST_PATH/dijkstra.h"
+using namespace std;
+
+struct Measurement {
+    double ms;          // Best time of a few runs
+    long long misses;   // Cache misses of the best run, -1 if not available
+};
+
+template <typename Run>
+Measurement measure(Run run, int repeats = 3) {
+    CacheMissCounter counter;
+    Measurement best = {1e18, -1};
+    for (int i = 0; i < repeats; i++) {
+        counter.start();
+        auto start = chrono::steady_clock::now();
+        run();
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        long long misses = counter.stop();
+        if (ms < best.ms) best = {ms, misses};
+    }
+    return best;
+}
+
+string show(const Measurement& m) {
+    ostringstream out;
+    out << fixed << setprecision(2) << m.ms << " ms / ";
+    if (m.misses >= 0) out << m.misses / 1000 << "k miss";
+    else out << "n/a";
+    return out.str();
+}
+
+// Every edge u -> v of the original DAG must have u before v
+bool validTopoOrder(const CSRGraph& dag, const vector<int>& order) {
+    vector<int> pos(dag.V);
+    for (int i = 0; i < (int)order.size(); i++) pos[order[i]] = i;
+    for (int u = 0; u < dag.V; u++) {
+        for (int v : dag.neighbors(u)) {
+            if (pos[u] > pos[v]) return false;
+        }
+    }
+    return (int)order.size() == dag.V;
+}
+
+void benchmarkGraph(const string& name, int V, const vector<Edge>& edges) {
+    CSRGraph und = buildCSR(V, edges, false);   // BFS + Dijkstra run on the undirected weighted graph
+
+    // Orient every edge from the smaller to the larger id → a DAG for the topological sort
+    vector<Edge> dagEdges;
+    for (auto e : edges) {
+        if (e.u == e.v) continue;
+        if (e.u > e.v) swap(e.u, e.v);
+        dagEdges.push_back(e);
+    }
+    CSRGraph dag = buildCSR(V, dagEdges);
+
+    // Query from the highest-degree vertex (vertex 0 may be isolated in RMAT graphs)
+    int source = 0;
+    for (int v = 1; v < V; v++) {
+        if (und.degree(v) > und.degree(source)) source = v;
+    }
+    vector<int> baseDist;
+    dijkstra(source, und, baseDist);
+    size_t baseReached = bfsOfGraph(und, source).size();
+
+    cout << endl << name << " (V = " << V << ", E = " << edges.size() << ")" << endl;
+    cout << left << setw(10) << "Order" << setw(11) << "Prep (ms)" << setw(26) << "bfsOfGraph"
+         << setw(26) << "dijkstra" << setw(26) << "topoSort" << "Same results" << endl;
+
+    vector<pair<string, Reordering (*)(const CSRGraph&)>> orderings = {
+        {"original", nullptr},
+        {"degree", degreeSortOrder},
+        {"bfs", bfsReorder},
+        {"rcm", rcmOrder},
+        {"gorder", [](const CSRGraph& g) { return gorderOrder(g); }},
+    };
+
+    for (auto& ordering : orderings) {
+        Reordering r;
+        auto start = chrono::steady_clock::now();
+        if (ordering.second) {
+            r = ordering.second(und);
+        } else {
+            vector<int> identity(V);
+            for (int v = 0; v < V; v++) identity[v] = v;
+            r = reorderingFromOrder(identity);
+        }
+        CSRGraph g = relabel(und, r);
+        CSRGraph d = relabel(dag, r);
+        double prepMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        int s = r.newId[source];
+        vector<int> traversal, dist, topo;
+        Measurement bfsM = measure([&] { traversal = bfsOfGraph(g, s); });
+        Measurement dijM = measure([&] { dijkstra(s, g, dist); });
+        Measurement topoM = measure([&] { topo = dfsTopoSort(d); });
+
+        // Answers mapped back to the original ids must match the unordered run
+        bool same = traversal.size() == baseReached
+                 && r.toOriginal(dist) == baseDist
+                 && validTopoOrder(dag, r.verticesToOriginal(topo));
+
+        cout << left << setw(10) << ordering.first << setw(11) << (long long)prepMs
+             << setw(26) << show(bfsM) << setw(26) << show(dijM) << setw(26) << show(topoM)
+             << (same ? "yes" : "NO") << endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    // Small example: a path 0 - 1 - 2 - 3 - 4 whose ids were scrambled by "an external system"
+    vector<Edge> edges = {{3, 0, 1}, {0, 4, 1}, {4, 1, 1}, {1, 2, 1}};
+    CSRGraph g = buildCSR(5, edges, false);
+
+    Reordering r = rcmOrder(g);
+    cout << "RCM labels (original -> new): ";
+    for (int v = 0; v < g.V; v++) cout << v << "->" << r.newId[v] << " ";
+    cout << endl;
+
+    vector<int> distNew;
+    dijkstra(r.newId[3], relabel(g, r), distNew);   // Query from original vertex 3
+    vector<int> dist = r.toOriginal(distNew);
+    cout << "Distances from 3 in original ids: ";
+    for (int v = 0; v < g.V; v++) cout << dist[v] << " ";
+    cout << endl;
+
+    // 📈 Before / after on a road-like grid and a power-law RMAT graph, both with shuffled ids
+    int side = argc > 1 ? atoi(argv[1]) : 700;
+    int scale = argc > 2 ? atoi(argv[2]) : 16;
+
+    vector<Edge> grid = gridEdges(side, side, 1, 100);
+    shuffleLabels(side * side, grid, 2);
+    benchmarkGraph("Grid " + to_string(side) + "x" + to_string(side) + ", shuffled ids", side * side, grid);
+
+    benchmarkGraph("RMAT scale " + to_string(scale), 1 << scale, rmatEdges(scale, 8, 1, 100));
+
+    if (!CacheMissCounter().available()) {
+        cout << endl << "(Cache-miss counters are not available here: perf_event_open is blocked)" << endl;
+    }
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Reordering is a one-time preprocessing cost (see CORE/reorder.h), typically a few BFS's worth.
+// It pays off when the relabeled graph is queried many times.
+// Mapping answers back → O(V) per query (or O(path length) for vertex lists).
+
+// 🧠 Space Complexity (SC):
+// newId + oldId → 2 * V ints, relabeled graph → O(V + E)
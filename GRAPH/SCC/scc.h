@@ -0,0 +1,307 @@
+// 📚 Strongly Connected Components (explained and benchmarked in 1-SCC.cpp)
+// Two engines with the same output:
+//   sccTarjan   → serial, iterative Tarjan (explicit stack, no recursion)
+//   sccParallel → parallel: trimming + forward-backward (FW-BW) for the giant SCC + coloring
+// Output: comp[v] = component id, numbered in TOPOLOGICAL order of the condensation
+// (every edge between two components goes from a lower id to a higher id), plus the
+// condensation DAG itself (one vertex per SCC, duplicate edges removed).
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "../BFS_DFS/bfs.h"   // parallelLevelSync
+#include "../TOPOLOGICAL SORT/kahn.h"
+using namespace std;
+
+struct SCCResult {
+    int numComponents = 0;
+    vector<int> comp;        // comp[v] = id of v's SCC, ids in topological order
+    CSRGraph condensation;   // Edge a -> b (a < b) if some edge of g goes from SCC a to SCC b
+};
+
+// Build the condensation from any component numbering; when `renumber` is set, the ids are first
+// rewritten into a topological order of the condensation (Kahn's algorithm on it).
+inline void finishSCC(const CSRGraph& g, SCCResult& res, bool renumber) {
+    int C = res.numComponents;
+    auto edgeCount = [&]() {
+        long long E = 0;
+        for (int u = 0; u < g.V; u++) {
+            for (int v : g.neighbors(u)) E += res.comp[u] != res.comp[v];
+        }
+        return E;
+    };
+
+    // Condensation with duplicate edges removed: lastFrom[c] = last component that linked to c
+    auto build = [&]() {
+        vector<vector<int>> members(C);
+        for (int v = 0; v < g.V; v++) members[res.comp[v]].push_back(v);
+
+        CSRGraph h;
+        h.V = C;
+        h.offsets.assign(C + 1, 0);
+        h.adj.reserve(edgeCount());
+        vector<int> lastFrom(C, -1);
+        for (int c = 0; c < C; c++) {
+            for (int u : members[c]) {
+                for (int v : g.neighbors(u)) {
+                    int d = res.comp[v];
+                    if (d != c && lastFrom[d] != c) {
+                        lastFrom[d] = c;
+                        h.adj.push_back(d);
+                    }
+                }
+            }
+            h.offsets[c + 1] = h.adj.size();
+        }
+        return h;
+    };
+
+    res.condensation = build();
+    if (!renumber) return;
+
+    vector<int> order = kahnTopoSort(res.condensation);   // Acyclic by construction
+    vector<int> newId(C);
+    for (int i = 0; i < C; i++) newId[order[i]] = i;
+    for (int& c : res.comp) c = newId[c];
+    res.condensation = build();
+}
+
+
+// 🔁 Serial: iterative Tarjan
+// index[v] = DFS discovery number, low[v] = smallest index reachable from v's DFS subtree through
+// vertices still on the Tarjan stack. When a vertex finishes with low[v] == index[v], it is the
+// root of an SCC: everything above it on the Tarjan stack forms that SCC.
+// SCCs are completed sinks-first (reverse topological order), so ids are assigned from the back.
+inline SCCResult sccTarjan(const CSRGraph& g) {
+    int V = g.V;
+    SCCResult res;
+    res.comp.assign(V, -1);
+
+    vector<int> index(V, -1), low(V, 0);
+    vector<int> tarjanStack;                 // Vertices whose SCC is not known yet
+    vector<pair<int, int>> callStack;        // (vertex, next edge index) → replaces recursion
+    tarjanStack.reserve(V);
+    int counter = 0, found = 0;
+
+    for (int root = 0; root < V; root++) {
+        if (index[root] != -1) continue;
+        index[root] = low[root] = counter++;
+        tarjanStack.push_back(root);
+        callStack.push_back({root, g.offsets[root]});
+
+        while (!callStack.empty()) {
+            int v = callStack.back().first;
+            int& edge = callStack.back().second;
+
+            if (edge < g.offsets[v + 1]) {
+                int w = g.adj[edge++];
+                if (index[w] == -1) {
+                    index[w] = low[w] = counter++;   // Tree edge: go deeper
+                    tarjanStack.push_back(w);
+                    callStack.push_back({w, g.offsets[w]});
+                } else if (res.comp[w] == -1) {
+                    low[v] = min(low[v], index[w]);  // w is still on the Tarjan stack
+                }
+                continue;
+            }
+
+            // v is finished
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                int parent = callStack.back().first;
+                low[parent] = min(low[parent], low[v]);
+            }
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = tarjanStack.back();
+                    tarjanStack.pop_back();
+                    res.comp[w] = found;
+                } while (w != v);
+                found++;
+            }
+        }
+    }
+
+    // Found order is reverse topological → flip the ids
+    res.numComponents = found;
+    for (int& c : res.comp) c = found - 1 - c;
+    finishSCC(g, res, false);
+    return res;
+}
+
+
+// 🧵 Parallel building block: reachability from src over edges of g, only through vertices with
+// allowed(v); reached vertices get mark[v] = 1. Runs on the shared level-synchronous BFS of bfs.h.
+template <typename Allowed>
+void parallelReach(const CSRGraph& g, int src, vector<atomic<char>>& mark, Allowed allowed, ThreadPool& pool) {
+    mark[src].store(1, memory_order_relaxed);
+    parallelLevelSync(g, src, pool, [&](int, int w, int) {
+        if (mark[w].load(memory_order_relaxed) || !allowed(w)) return false;
+        char expected = 0;
+        return mark[w].compare_exchange_strong(expected, 1, memory_order_relaxed);
+    });
+}
+
+// 🧵 Parallel SCC
+// 1. Trim: a vertex with no active in-neighbor or no active out-neighbor is an SCC by itself
+//    (repeated until nothing changes; removes all the "tree-like" parts of the graph).
+// 2. FW-BW: from a pivot with large in * out degree, parallel forward and backward reachability;
+//    forward ∩ backward = the pivot's SCC (usually the giant one).
+// 3. Trim again, then coloring for the many small SCCs that are left:
+//    color[v] = min vertex id that can reach v (propagated along edges in parallel rounds,
+//    each round only rescans the vertices whose color dropped in the previous one);
+//    every v with color[v] == v is a root, and the vertices of its color that reach it
+//    (backward search inside the color) are its SCC. Searches of different roots never overlap.
+// Ids are handed out in discovery order, then renumbered topologically by finishSCC.
+inline SCCResult sccParallel(const CSRGraph& g, ThreadPool& pool) {
+    int V = g.V;
+    CSRGraph inG = transposeCSR(g);
+    vector<atomic<int>> comp(V);
+    for (int v = 0; v < V; v++) comp[v].store(-1, memory_order_relaxed);
+    atomic<int> nextId(0);
+    ChunkQueue work;
+
+    auto active = [&](int v) { return comp[v].load(memory_order_relaxed) == -1; };
+
+    auto trim = [&]() {
+        atomic<bool> changed(true);
+        while (changed.load()) {
+            changed = false;
+            work.reset(V, 1024);
+            pool.run([&](int) {
+                long long begin, end;
+                while (work.grab(begin, end)) {
+                    for (long long v = begin; v < end; v++) {
+                        if (!active(v)) continue;
+                        bool hasIn = false, hasOut = false;
+                        for (int u : inG.neighbors(v)) if (u != v && active(u)) { hasIn = true; break; }
+                        if (hasIn) for (int w : g.neighbors(v)) if (w != v && active(w)) { hasOut = true; break; }
+                        if (!hasIn || !hasOut) {
+                            comp[v].store(nextId.fetch_add(1, memory_order_relaxed), memory_order_relaxed);
+                            changed.store(true, memory_order_relaxed);
+                        }
+                    }
+                }
+            });
+        }
+    };
+
+    trim();
+
+    // FW-BW from the active vertex with the largest in-degree * out-degree
+    int pivot = -1;
+    long long best = -1;
+    for (int v = 0; v < V; v++) {
+        long long score = (long long)g.degree(v) * inG.degree(v);
+        if (active(v) && score > best) { best = score; pivot = v; }
+    }
+    if (pivot != -1) {
+        vector<atomic<char>> fw(V), bw(V);
+        for (int v = 0; v < V; v++) {
+            fw[v].store(0, memory_order_relaxed);
+            bw[v].store(0, memory_order_relaxed);
+        }
+        parallelReach(g, pivot, fw, active, pool);
+        parallelReach(inG, pivot, bw, active, pool);
+
+        int id = nextId.fetch_add(1);
+        work.reset(V, 1024);
+        pool.run([&](int) {
+            long long begin, end;
+            while (work.grab(begin, end)) {
+                for (long long v = begin; v < end; v++) {
+                    if (fw[v].load(memory_order_relaxed) && bw[v].load(memory_order_relaxed))
+                        comp[v].store(id, memory_order_relaxed);
+                }
+            }
+        });
+        trim();
+    }
+
+    // Coloring rounds for what is left
+    vector<atomic<int>> color(V);
+    vector<atomic<char>> queued(V);   // Already in the next frontier of the color propagation
+    for (int v = 0; v < V; v++) queued[v].store(0, memory_order_relaxed);
+    vector<vector<int>> local(pool.size()), localStack(pool.size());
+    while (true) {
+        bool any = false;
+        for (int v = 0; v < V && !any; v++) any = active(v);
+        if (!any) break;
+
+        // Propagate the minimum color forward; only vertices whose color just dropped are rescanned
+        vector<int> frontier;
+        for (int v = 0; v < V; v++) {
+            color[v].store(v, memory_order_relaxed);
+            if (active(v)) frontier.push_back(v);
+        }
+        while (!frontier.empty()) {
+            work.reset(frontier.size(), 256);
+            pool.run([&](int tid) {
+                local[tid].clear();
+                long long begin, end;
+                while (work.grab(begin, end)) {
+                    for (long long i = begin; i < end; i++) {
+                        int v = frontier[i];
+                        int c = color[v].load(memory_order_relaxed);
+                        for (int w : g.neighbors(v)) {
+                            if (active(w) && atomicMin(color[w], c) && !queued[w].exchange(1, memory_order_relaxed))
+                                local[tid].push_back(w);
+                        }
+                    }
+                }
+            });
+            frontier.clear();
+            for (auto& buf : local) frontier.insert(frontier.end(), buf.begin(), buf.end());
+            for (int w : frontier) queued[w].store(0, memory_order_relaxed);
+        }
+
+        // Every root collects its SCC with a backward search inside its color
+        work.reset(V, 256);
+        pool.run([&](int tid) {
+            vector<int>& stack = localStack[tid];
+            long long begin, end;
+            while (work.grab(begin, end)) {
+                for (long long r = begin; r < end; r++) {
+                    if (!active(r) || color[r].load(memory_order_relaxed) != r) continue;
+                    int id = nextId.fetch_add(1, memory_order_relaxed);
+                    comp[r].store(id, memory_order_relaxed);
+                    stack.assign(1, (int)r);
+                    while (!stack.empty()) {
+                        int x = stack.back();
+                        stack.pop_back();
+                        for (int u : inG.neighbors(x)) {
+                            if (color[u].load(memory_order_relaxed) == r && active(u)) {
+                                comp[u].store(id, memory_order_relaxed);   // Only root r owns color r
+                                stack.push_back(u);
+                            }
+                        }
+                    }
+                }
+            }
+        });
+        trim();
+    }
+
+    SCCResult res;
+    res.numComponents = nextId.load();
+    res.comp.resize(V);
+    for (int v = 0; v < V; v++) res.comp[v] = comp[v].load(memory_order_relaxed);
+    finishSCC(g, res, true);
+    return res;
+}
+
+
+// ⏱ Time Complexity (TC):
+// sccTarjan → O(V + E)
+// sccParallel → O(V + E) per trimming sweep / FW-BW, O(rounds * (V + E)) for coloring;
+//               graphs with one giant SCC finish after trim + one FW-BW.
+// Condensation + topological renumbering → O(V + E)
+
+// 🧠 Space Complexity (SC):
+// Tarjan → index, low, comp + two stacks → O(V)
+// Parallel → transpose graph O(V + E) + a few atomic arrays O(V)
@@ -14,64 +14,24 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
 #include <climits>
+#include "../CORE/csr_graph.h"
+#include "dijkstra.h"   // dijkstra(start, graph, dist)
 
 using namespace std;
 
-// Typedef for a pair representing (node, weight)
-typedef pair<int, int> pii;
-
-// Dijkstra's Algorithm function
-void dijkstra(int start, vector<vector<pii>>& graph, vector<int>& dist) {
-    int n = graph.size();
-
-    // Initialize all distances to infinity
-    dist.assign(n, INT_MAX);
-    dist[start] = 0;
-
-    // Min-heap priority queue to get the node with the smallest distance
-    priority_queue<pii, vector<pii>, greater<pii>> pq;
-    pq.push({0, start}); // (distance, node)
-
-    while (!pq.empty()) {
-        int current_dist = pq.top().first;
-        int u = pq.top().second;
-        pq.pop();
-
-        // If this path is longer than the already found shortest path, skip
-        if (current_dist > dist[u]) continue;
-
-        // Traverse all neighbors of the current node
-        for (auto edge : graph[u]) {
-            int v = edge.first;       // Neighbor node
-            int weight = edge.second; // Edge weight
-
-            // Relaxation step: if a shorter path to v is found
-            if (dist[v] > dist[u] + weight) {
-                dist[v] = dist[u] + weight;
-                pq.push({dist[v], v});
-            }
-        }
-    }
-}
-
 int main() {
     int nodes = 5;
 
-    // Adjacency list: graph[u] contains pairs (v, weight)
-    vector<vector<pii>> graph(nodes);
-
-    // Adding directed edges: u -> v with weight
-    graph[0].push_back({1, 10});
-    graph[0].push_back({4, 5});
-    graph[1].push_back({2, 1});
-    graph[1].push_back({4, 2});
-    graph[2].push_back({3, 4});
-    graph[3].push_back({0, 7});
-    graph[4].push_back({1, 3});
-    graph[4].push_back({2, 9});
-    graph[4].push_back({3, 2});
+    // Directed edges: u -> v with weight, built once into a CSR graph
+    vector<Edge> edges = {
+        {0, 1, 10}, {0, 4, 5},
+        {1, 2, 1}, {1, 4, 2},
+        {2, 3, 4},
+        {3, 0, 7},
+        {4, 1, 3}, {4, 2, 9}, {4, 3, 2}
+    };
+    CSRGraph graph = buildCSR(nodes, edges);
 
     vector<int> dist; // To store shortest distances from source
 
@@ -104,7 +64,7 @@ int main() {
 // ✅ Space Complexity (SC):
 // Distance array → O(V)
 // Priority queue → up to O(V)
-// Adjacency list → O(V + E)
+// Adjacency list / CSR graph → O(V + E)
 // 🔸 Overall:
 // O(V + E)
 
@@ -17,46 +17,18 @@
 #include <iostream>
 #include <vector>
 #include <climits>
+#include "../CORE/csr_graph.h"   // Provides struct Edge {u, v, weight} and CSRGraph
+#include "bellman_ford.h"        // bellmanFord(graph, src, dist) on a CSR graph
 
 using namespace std;
 
-// Structure to represent an edge from u to v with a given weight
-struct Edge {
-    int u, v, weight;
-};
-
-// Bellman-Ford function
-void bellmanFord(int V, int E, int src, vector<Edge>& edges) {
-    // Step 1: Initialize distances from source to all vertices as infinity
-    vector<int> dist(V, INT_MAX);
-    dist[src] = 0;
-
-    // Step 2: Relax all edges (V - 1) times
-    // This ensures shortest distances are computed considering all possible paths
-    for (int i = 1; i <= V - 1; i++) {
-        for (int j = 0; j < E; j++) {
-            int u = edges[j].u;
-            int v = edges[j].v;
-            int wt = edges[j].weight;
-
-            // If the distance to u is not infinite and a shorter path to v is found
-            if (dist[u] != INT_MAX && dist[u] + wt < dist[v]) {
-                dist[v] = dist[u] + wt;
-            }
-        }
-    }
+// Bellman-Ford on a CSR graph, printing the distances from src
+void bellmanFord(int V, int src, const CSRGraph& graph) {
+    vector<int> dist;
 
-    // Step 3: Check for negative weight cycles
-    for (int j = 0; j < E; j++) {
-        int u = edges[j].u;
-        int v = edges[j].v;
-        int wt = edges[j].weight;
-
-        // If we can still relax an edge, then a negative cycle exists
-        if (dist[u] != INT_MAX && dist[u] + wt < dist[v]) {
-            cout << "Graph contains a negative weight cycle!" << endl;
-            return;
-        }
+    if (!bellmanFord(graph, src, dist)) {
+        cout << "Graph contains a negative weight cycle!" << endl;
+        return;
     }
 
     // Step 4: Print the shortest distances
@@ -69,9 +41,24 @@ void bellmanFord(int V, int E, int src, vector<Edge>& edges) {
     }
 }
 
+// Bellman-Ford function (edges: a vector<Edge> or any contiguous Edge array, not copied; E = edges.size())
+void bellmanFord(int V, int src, ArrayView<Edge> edges) {
+    // Build the CSR graph once and run the algorithm on it
+    bellmanFord(V, src, buildCSR(V, edges));
+}
+
+// Struct-of-arrays input: u[], v[] and w[] columns
+void bellmanFord(int V, int src, const EdgeColumns& edges) {
+    bellmanFord(V, src, buildCSR(V, edges));
+}
+
+// Classic signature, kept for existing callers (E must equal edges.size())
+void bellmanFord(int V, int /*E*/, int src, vector<Edge>& edges) {
+    bellmanFord(V, src, ArrayView<Edge>(edges));
+}
+
 int main() {
     int V = 5; // Number of vertices
-    int E = 8; // Number of edges
 
     // Create edge list
     vector<Edge> edges = {
@@ -88,7 +75,7 @@ int main() {
     int source = 0; // Source vertex
 
     // Call Bellman-Ford algorithm
-    bellmanFord(V, E, source, edges);
+    bellmanFord(V, source, edges);
 
     return 0;
 }
@@ -105,7 +92,7 @@ int main() {
 // 📦 Space Complexity (SC)
 // Memory usage:
 // Distance array → O(V)
-// Edge list → O(E)
+// Edge list / CSR graph → O(V + E)
 // ✅ Total Space Complexity:
 // O(V + E)
 
@@ -16,9 +16,10 @@
 
 #include <iostream>
 #include <vector>
+#include "floyd_warshall.h"   // floydWarshallDistances(dist, inf)
 using namespace std;
 
-#define INF 1e9  // Use a large number to represent infinity
+#define INF 1000000000  // Use a large number to represent infinity (an int: 1e9 is a double)
 #define V 4      // Number of vertices
 
 // Function to run Floyd-Warshall algorithm
@@ -26,23 +27,10 @@ void floydWarshall(vector<vector<int>>& graph) {
     // Step 1: Create a distance matrix initialized with the input graph
     vector<vector<int>> dist = graph;
 
-    // Step 2: Apply the Floyd-Warshall algorithm
-    for (int k = 0; k < V; k++) {         // Intermediate vertex
-        for (int i = 0; i < V; i++) {     // Source vertex
-            for (int j = 0; j < V; j++) { // Destination vertex
-                // If a shorter path exists through vertex k, update it
-                if (dist[i][k] < INF && dist[k][j] < INF)
-                    dist[i][j] = min(dist[i][j], dist[i][k] + dist[k][j]);
-            }
-        }
-    }
-
-    // Step 3: Check for negative weight cycles
-    for (int i = 0; i < V; i++) {
-        if (dist[i][i] < 0) {
-            cout << "Graph contains a negative weight cycle!\n";
-            return;
-        }
+    // Steps 2 + 3: Apply the Floyd-Warshall algorithm and check for negative weight cycles
+    if (!floydWarshallDistances(dist, INF)) {
+        cout << "Graph contains a negative weight cycle!\n";
+        return;
     }
 
     // Step 4: Print the shortest path matrix
@@ -58,20 +46,20 @@ void floydWarshall(vector<vector<int>>& graph) {
     }
 }
 
-// int main() {
+int main() {
     // Graph represented as adjacency matrix
-    // vector<vector<int>> graph = {
-    //     {0,   5,   INF, 10},
-    //     {INF, 0,   3,   INF},
-    //     {INF, INF, 0,   1},
-    //     {INF, INF, INF, 0}
-    // };
+    vector<vector<int>> graph = {
+        {0,   5,   INF, 10},
+        {INF, 0,   3,   INF},
+        {INF, INF, 0,   1},
+        {INF, INF, INF, 0}
+    };
 
     // Run the algorithm
-//     floydWarshall(graph);
+    floydWarshall(graph);
 
-//     return 0;
-// }
+    return 0;
+}
 
 // ⏱️ Time Complexity (TC)
 // Explanation:
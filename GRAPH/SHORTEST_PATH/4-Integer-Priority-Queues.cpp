@@ -0,0 +1,91 @@
+// 🪣 Dijkstra with integer priority queues: binary heap vs radix heap vs Dial's buckets
+// On road-network-like graphs most of Dijkstra's time goes into the priority queue:
+// every relaxation is a push (O(log n) sift in a binary heap), and every improved distance leaves
+// a stale entry behind that still has to be popped and skipped.
+// Edge weights here are non-negative integers and the popped distances never decrease,
+// so integer "monotone" queues can replace the comparison-based heap (dijkstra_queues.h):
+//   RadixHeapQueue → keys are grouped by the highest bit that differs from the last popped key
+//   DialQueue      → one bucket per distance value, modulo (max weight + 1)
+//                    (radix heap instead when the max weight is too large for an array of buckets)
+
+// 🔧 The queue is a template parameter (dijkstraWith<Queue>), so the choice is made at compile time;
+// plain dijkstra() uses DIJKSTRA_QUEUE, e.g. g++ -DDIJKSTRA_QUEUE=DialQueue ...
+// Usage: ./a.out [grid side = 1000] [queries = 10]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+#include "dijkstra.h"          // dijkstraWith, DijkstraStats, queue policies
+#include "queue_benchmark.h"   // runQueueQueries
+using namespace std;
+
+template <typename Queue>
+void runQueue(const string& name, const CSRGraph& g, const vector<int>& sources,
+              const vector<vector<int>>& expected) {
+    QueueRunResult r = runQueueQueries<Queue>(g, sources, expected);
+    int q = sources.size();
+    cout << setw(18) << name << setw(12) << fixed << setprecision(2) << r.msPerQuery
+         << setw(14) << r.total.pushes / q << setw(14) << r.total.stalePops / q
+         << setw(8) << (r.same ? "yes" : "NO") << endl;
+}
+
+int main(int argc, char** argv) {
+    // Small example: same graph as 1-Dijkstra’s-Algo.cpp, every queue gives the same distances
+    vector<Edge> edges = {
+        {0, 1, 10}, {0, 4, 5}, {1, 2, 1}, {1, 4, 2}, {2, 3, 4},
+        {3, 0, 7}, {4, 1, 3}, {4, 2, 9}, {4, 3, 2}
+    };
+    CSRGraph small = buildCSR(5, edges);
+    vector<int> d1, d2, d3;
+    dijkstraWith<BinaryHeapQueue>(0, small, d1);
+    dijkstraWith<RadixHeapQueue>(0, small, d2);
+    dijkstraWith<DialQueue>(0, small, d3);
+    cout << "Distances from 0 (binary / radix / Dial): ";
+    for (int i = 0; i < 5; i++) cout << d1[i] << "/" << d2[i] << "/" << d3[i] << " ";
+    cout << endl;
+
+    // Weights near 10^9 would need 10^9 buckets: DialQueue switches to its radix-heap fallback
+    vector<Edge> heavyEdges = {{0, 1, 1000000000}, {0, 2, 1}, {2, 1, 5}};
+    CSRGraph heavy = buildCSR(3, heavyEdges);
+    DialQueue heavyQueue(heavy);
+    vector<int> dh;
+    dijkstraWith(0, heavy, dh, heavyQueue);
+    cout << "Max weight 10^9: dist(0, 1) = " << dh[1]
+         << (heavyQueue.usesFallback() ? " (Dial fell back to the radix heap)" : "") << endl;
+
+    // 📈 Road-like graph: undirected grid with random integer travel times
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    int numQueries = argc > 2 ? atoi(argv[2]) : 10;
+
+    for (int maxWeight : {100, 10000}) {
+        CSRGraph g = buildCSR(side * side, gridEdges(side, side, 7, maxWeight), false);
+        vector<int> sources;
+        for (int i = 0; i < numQueries; i++) sources.push_back((int)((i * 2654435761LL) % g.V));
+
+        vector<vector<int>> expected(numQueries);
+        for (int i = 0; i < numQueries; i++) dijkstraWith<BinaryHeapQueue>(sources[i], g, expected[i]);
+
+        cout << endl << side << " x " << side << " grid, weights 1.." << maxWeight
+             << " (V = " << g.V << ", E = " << g.numEdges() << "), per query:" << endl;
+        cout << setw(18) << "Queue" << setw(12) << "ms" << setw(14) << "pushes"
+             << setw(14) << "stale pops" << setw(8) << "same" << endl;
+        runQueue<BinaryHeapQueue>("Binary heap", g, sources, expected);
+        runQueue<RadixHeapQueue>("Radix heap", g, sources, expected);
+        runQueue<DialQueue>("Dial's buckets", g, sources, expected);
+    }
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC), one query, C = max edge weight:
+// Binary heap → O((V + E) log V)
+// Radix heap  → O(E + V log C)
+// Dial        → O(V + E + max distance)
+
+// 🧠 Space Complexity (SC):
+// O(V + E) graph + distances; each queue holds at most one entry per relaxation
@@ -0,0 +1,95 @@
+// 🌳 Dijkstra with an indexed d-ary heap (true decrease-key) vs lazy deletion
+// The classic dijkstra pushes a NEW {dist, node} pair on every successful relaxation and skips
+// outdated pairs when they come out (current_dist > dist[u]). On dense / high-degree graphs a
+// vertex is improved many times, so the heap grows towards E entries and most pops are stale.
+
+// 🧠 IndexedDaryHeap<D> (dijkstra_queues.h)
+// pos[v] remembers where v sits in the heap, so an improved distance updates v IN PLACE and
+// sifts it up (decrease-key): at most one entry per vertex → heap size ≤ V, zero stale pops.
+// D children per node (default 4): the heap is log_D(V) levels deep, and the D children of a
+// node are adjacent in memory, so finding the smallest child touches one or two cache lines.
+// It is just another queue policy: dijkstraWith<IndexedDaryHeap<4>>(src, g, dist).
+
+// Usage: ./a.out [rmat scale = 16] [queries = 5]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+#include "../CORE/perf_counter.h"
+#include "dijkstra.h"          // dijkstraWith, DijkstraStats, BinaryHeapQueue, IndexedDaryHeap
+#include "queue_benchmark.h"   // runQueueQueries
+using namespace std;
+
+template <typename Queue>
+void runQueue(const string& name, const CSRGraph& g, const vector<int>& sources,
+              const vector<vector<int>>& expected) {
+    CacheMissCounter counter;
+    QueueRunResult r = runQueueQueries<Queue>(g, sources, expected, &counter);
+    int q = sources.size();
+    cout << setw(16) << name << setw(10) << fixed << setprecision(2) << r.msPerQuery
+         << setw(12) << r.total.pushes / q << setw(12) << r.total.stalePops / q
+         << setw(12) << r.total.maxQueueSize
+         << setw(10) << setprecision(0) << r.total.maxQueueSize * sizeof(pair<int, int>) / 1024.0
+         << setw(14);
+    if (r.cacheMisses >= 0) cout << r.cacheMisses / q;
+    else cout << "n/a";
+    cout << setw(6) << (r.same ? "yes" : "NO") << endl;
+}
+
+void benchmark(const string& name, const CSRGraph& g, int numQueries) {
+    vector<int> sources;
+    for (int i = 0; i < numQueries; i++) sources.push_back((int)((i * 2654435761LL + 12345) % g.V));
+    vector<vector<int>> expected(numQueries);
+    for (int i = 0; i < numQueries; i++) dijkstraWith<BinaryHeapQueue>(sources[i], g, expected[i]);
+
+    cout << endl << name << " (V = " << g.V << ", E = " << g.numEdges()
+         << ", avg degree " << g.numEdges() / g.V << "), per query:" << endl;
+    cout << setw(16) << "Queue" << setw(10) << "ms" << setw(12) << "pushes" << setw(12) << "stale pops"
+         << setw(12) << "max entries" << setw(10) << "max KiB" << setw(14) << "LLC misses" << setw(6) << "same" << endl;
+
+    // Both store pair<int, int> entries (the indexed heap's pos[] array is V ints, allocated once per graph)
+    runQueue<BinaryHeapQueue>("Lazy binary", g, sources, expected);
+    runQueue<IndexedDaryHeap<2>>("Indexed 2-ary", g, sources, expected);
+    runQueue<IndexedDaryHeap<4>>("Indexed 4-ary", g, sources, expected);
+    runQueue<IndexedDaryHeap<8>>("Indexed 8-ary", g, sources, expected);
+}
+
+int main(int argc, char** argv) {
+    // Small example: same graph as 1-Dijkstra’s-Algo.cpp
+    vector<Edge> edges = {
+        {0, 1, 10}, {0, 4, 5}, {1, 2, 1}, {1, 4, 2}, {2, 3, 4},
+        {3, 0, 7}, {4, 1, 3}, {4, 2, 9}, {4, 3, 2}
+    };
+    vector<int> dist;
+    dijkstraWith<IndexedDaryHeap<4>>(0, buildCSR(5, edges), dist);
+    cout << "Shortest distances from node 0 (indexed 4-ary heap): ";
+    for (int d : dist) cout << d << " ";
+    cout << endl;
+
+    int scale = argc > 1 ? atoi(argv[1]) : 16;
+    int numQueries = argc > 2 ? atoi(argv[2]) : 5;
+
+    // 📈 High-degree graphs: power-law (hubs with thousands of neighbors) and a dense random graph
+    benchmark("RMAT, edge factor 32", buildCSR(1 << scale, rmatEdges(scale, 32, 3, 1000), false), numQueries);
+    int denseV = 1 << (scale - 4);
+    benchmark("Dense random graph", buildCSR(denseV, randomDagEdges(denseV, 256LL * denseV, 4, 1000), false), numQueries);
+
+    // Sparse road-like grid for contrast (few improvements per vertex → little to gain)
+    int side = 1 << (scale / 2 + 1);
+    benchmark("Grid", buildCSR(side * side, gridEdges(side, side, 5, 1000), false), numQueries);
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC), one query:
+// Lazy binary heap → O(E log E): up to E entries, each pushed and popped once
+// Indexed D-ary    → O(V D log_D V + E log_D V): ≤ V entries, decrease-key instead of new entries
+
+// 🧠 Space Complexity (SC):
+// Lazy binary heap → O(E) entries in the worst case
+// Indexed D-ary    → O(V) entries + O(V) position array
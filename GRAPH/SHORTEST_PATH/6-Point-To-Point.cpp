@@ -0,0 +1,102 @@
+// 📍 Point-to-point shortest path queries (s → t)
+// Routing asks for ONE route at a time, but dijkstra(start, graph, dist) settles every vertex of
+// the graph and returns all distances. point_to_point.h adds query modes that stop early:
+//   1. Early exit     → Dijkstra from s, stop the moment t is settled
+//   2. Bidirectional  → grow a ball around s (forward) and one around t (on the reversed graph);
+//                       two balls of radius d/2 cover far less than one ball of radius d
+//   3. A* + ALT       → order the search by dist(s, v) + lowerBound(v, t). The bounds come from
+//                       a few landmarks with precomputed exact distances (triangle inequality),
+//                       so the search heads towards t instead of spreading in every direction
+// Every mode returns the distance, the path and the number of settled vertices.
+
+// Usage: ./a.out [grid side = 1000] [queries = 20] [landmarks = 8]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+#include "dijkstra.h"
+#include "point_to_point.h"
+using namespace std;
+
+int main(int argc, char** argv) {
+    // Small example: same graph as 1-Dijkstra’s-Algo.cpp, route 0 → 2
+    vector<Edge> edges = {
+        {0, 1, 10}, {0, 4, 5}, {1, 2, 1}, {1, 4, 2}, {2, 3, 4},
+        {3, 0, 7}, {4, 1, 3}, {4, 2, 9}, {4, 3, 2}
+    };
+    CSRGraph small = buildCSR(5, edges);
+    CSRGraph smallRev = transposeCSR(small);
+    PathResult r = shortestPathBidirectional(small, smallRev, 0, 2);
+    cout << "Shortest path 0 -> 2: distance " << r.dist << ", path ";
+    for (size_t i = 0; i < r.path.size(); i++) cout << (i ? " -> " : "") << r.path[i];
+    cout << endl;
+
+    // 📈 Road-like grid: random s, t pairs
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    int numQueries = argc > 2 ? atoi(argv[2]) : 20;
+    int numLandmarks = argc > 3 ? atoi(argv[3]) : 8;
+    CSRGraph g = buildCSR(side * side, gridEdges(side, side, 11, 100), false);
+    CSRGraph rev = transposeCSR(g);
+
+    auto start = chrono::steady_clock::now();
+    ALTLandmarks alt;
+    alt.build(g, rev, numLandmarks);
+    double altMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << endl << side << " x " << side << " grid (V = " << g.V << "), " << numQueries << " queries, "
+         << numLandmarks << " landmarks built in " << altMs << " ms" << endl;
+
+    vector<pair<int, int>> queries;
+    for (int i = 0; i < numQueries; i++) {
+        queries.push_back({(int)((i * 2654435761LL) % g.V), (int)((i * 40503LL + 7919) % g.V)});
+    }
+
+    // Reference distances: full Dijkstra from s (settles the whole graph)
+    vector<int> expected;
+    vector<int> dist;
+    IndexedDaryHeap<4> pq(g);
+    start = chrono::steady_clock::now();
+    for (auto& q : queries) {
+        dijkstraWith(q.first, g, dist, pq);
+        expected.push_back(dist[q.second]);
+    }
+    double fullMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / numQueries;
+
+    cout << setw(22) << "Mode" << setw(12) << "ms/query" << setw(16) << "settled/query" << setw(8) << "correct" << endl;
+    cout << setw(22) << "Full Dijkstra" << setw(12) << fixed << setprecision(3) << fullMs
+         << setw(16) << g.V << setw(8) << "-" << endl;
+
+    auto runMode = [&](const string& name, auto query) {
+        long long settled = 0;
+        bool ok = true;
+        auto begin = chrono::steady_clock::now();
+        for (size_t i = 0; i < queries.size(); i++) {
+            PathResult res = query(queries[i].first, queries[i].second);
+            settled += res.settled;
+            ok = ok && res.dist == expected[i] && validPath(g, queries[i].first, queries[i].second, res);
+        }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count() / numQueries;
+        cout << setw(22) << name << setw(12) << ms << setw(16) << settled / numQueries
+             << setw(8) << (ok ? "yes" : "NO") << endl;
+    };
+
+    // One pair of workspaces for all queries (O(1) reset, see sssp_workspace.h)
+    SSSPWorkspace<> forward(g.V), backward(g.V);
+    runMode("Early exit", [&](int s, int t) { return shortestPath(g, s, t, forward); });
+    runMode("Bidirectional", [&](int s, int t) { return shortestPathBidirectional(g, rev, s, t, forward, backward); });
+    runMode("A* + ALT", [&](int s, int t) { return shortestPathAStar(g, s, t, alt.towards(t), forward); });
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Each mode is Dijkstra restricted to the vertices it settles; the savings are the settled counts.
+// ALT preprocessing → 2 * landmarks full Dijkstra runs (once per graph)
+
+// 🧠 Space Complexity (SC):
+// O(V) per workspace (reused by every query); ALT adds 2 * landmarks * V 64-bit distances
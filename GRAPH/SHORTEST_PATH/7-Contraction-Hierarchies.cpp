@@ -0,0 +1,138 @@
+// 🏔 Contraction Hierarchies: fast routing queries after preprocessing (contraction_hierarchies.h)
+// Even bidirectional Dijkstra settles a large part of a road network for a long route.
+// CH moves that work into a one-time preprocessing step:
+//   1. Order the vertices by importance (edge difference: how many shortcuts contracting a vertex
+//      would add minus how many edges it removes) and contract them in that order. Removing v
+//      adds a shortcut u → w unless a witness path u ⇝ w avoiding v is shorter than u → v → w.
+//   2. Store the result as two CSRs that only point to more important vertices (upward / downward).
+//   3. Query: a forward search from s on upward edges and a backward search from t on downward
+//      edges; the best meeting vertex gives the distance, shortcuts are expanded back to the path.
+// Preprocessing runs in parallel rounds and is saved to disk, tagged with the graph's checksum.
+
+// 📏 Measured on the 300 x 300 grid (V = 90,000, E = 358,800, one thread): preprocessing ~10-12 s and
+// 412,726 shortcuts, MORE than the original edges (a grid has no natural hierarchy of roads);
+// a query settles ~290 vertices in ~75-100 µs, vs ~5 ms for bidirectional Dijkstra.
+// Lazy updates (third argument) simulate ~2.3x fewer contractions and build ~1.8x faster, but the order
+// suffers: ~548k shortcuts and ~350 settled per query. A hop limit on the witness searches did not
+// help here (6 hops: same cost, 3 hops: 3x the shortcuts), it pays off on graphs with dense cores.
+
+// Usage: ./a.out [grid side = 300] [queries = 1000] [lazy updates = 0]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+#include "../CORE/parallel.h"
+#include "point_to_point.h"
+#include "contraction_hierarchies.h"
+using namespace std;
+
+double msSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    ThreadPool pool;
+
+    // Small example: same graph as 1-Dijkstra’s-Algo.cpp
+    vector<Edge> edges = {
+        {0, 1, 10}, {0, 4, 5}, {1, 2, 1}, {1, 4, 2}, {2, 3, 4},
+        {3, 0, 7}, {4, 1, 3}, {4, 2, 9}, {4, 3, 2}
+    };
+    CSRGraph small = buildCSR(5, edges);
+    ContractionHierarchy smallCH;
+    smallCH.build(small, pool);
+    CHQuery smallQuery(smallCH);
+    PathResult r = smallQuery.query(0, 2);
+    cout << "CH route 0 -> 2: distance " << r.dist << ", path ";
+    for (size_t i = 0; i < r.path.size(); i++) cout << (i ? " -> " : "") << r.path[i];
+    cout << " (" << smallCH.numShortcuts() << " shortcuts)" << endl;
+
+    // 📈 Road-like grid
+    int side = argc > 1 ? atoi(argv[1]) : 300;
+    int numQueries = argc > 2 ? atoi(argv[2]) : 1000;
+    bool lazy = argc > 3 && atoi(argv[3]) != 0;
+    CSRGraph g = buildCSR(side * side, gridEdges(side, side, 13, 100), false);
+    CSRGraph rev = transposeCSR(g);
+    cout << endl << side << " x " << side << " grid: V = " << g.V << ", E = " << g.numEdges()
+         << ", " << pool.size() << " threads" << endl;
+
+    auto start = chrono::steady_clock::now();
+    ContractionHierarchy ch(500, INT_MAX, lazy);
+    ch.build(g, pool);
+    cout << "Preprocessing" << (lazy ? " (lazy updates): " : ": ") << fixed << setprecision(0) << msSince(start)
+         << " ms, " << ch.rounds() << " rounds, " << ch.simulations() << " simulated contractions, "
+         << ch.numShortcuts() << " shortcuts, " << ch.memoryBytes() / (1 << 20) << " MiB" << endl;
+
+    // 💾 Save + load (what later runs do instead of preprocessing)
+    string path = "/tmp/ch_grid_demo.chx";
+    string error;
+    ContractionHierarchy loaded;
+    start = chrono::steady_clock::now();
+    if (!ch.save(path, error) || !loaded.load(path, g, error)) {
+        cout << error << endl;
+        return 1;
+    }
+    cout << "Save + load: " << setprecision(1) << msSince(start) << " ms" << endl;
+
+    // Loading for a different graph version is refused
+    CSRGraph changed = buildCSR(side * side, gridEdges(side, side, 14, 100), false);
+    ContractionHierarchy stale;
+    if (!stale.load(path, changed, error)) cout << "Changed graph: " << error << endl;
+    remove(path.c_str());
+
+    vector<pair<int, int>> queries;
+    for (int i = 0; i < numQueries; i++) {
+        queries.push_back({(int)((i * 2654435761LL) % g.V), (int)((i * 40503LL + 7919) % g.V)});
+    }
+
+    // Reference: bidirectional Dijkstra (on a sample, it is slow)
+    int sample = min(numQueries, 50);
+    vector<long long> expected(sample);
+    long long biSettled = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < sample; i++) {
+        PathResult res = shortestPathBidirectional(g, rev, queries[i].first, queries[i].second);
+        expected[i] = res.dist;
+        biSettled += res.settled;
+    }
+    double biUs = msSince(start) * 1000 / sample;
+
+    CHQuery query(loaded);
+    bool ok = true;
+    for (int i = 0; i < sample; i++) {
+        PathResult res = query.query(queries[i].first, queries[i].second);
+        ok = ok && res.dist == expected[i] && validPath(g, queries[i].first, queries[i].second, res);
+    }
+
+    long long chSettled = 0;
+    start = chrono::steady_clock::now();
+    for (auto& q : queries) chSettled += query.query(q.first, q.second, false).settled;
+    double chUs = msSince(start) * 1000 / numQueries;
+
+    start = chrono::steady_clock::now();
+    for (auto& q : queries) query.query(q.first, q.second, true);
+    double chPathUs = msSince(start) * 1000 / numQueries;
+
+    cout << endl << setw(24) << "Per query" << setw(14) << "µs" << setw(12) << "settled" << endl;
+    cout << setw(24) << "Bidirectional Dijkstra" << setw(14) << setprecision(1) << biUs
+         << setw(12) << biSettled / sample << endl;
+    cout << setw(24) << "CH, distance" << setw(14) << chUs << setw(12) << chSettled / numQueries << endl;
+    cout << setw(24) << "CH, distance + path" << setw(14) << chPathUs << setw(12) << chSettled / numQueries << endl;
+    cout << "Same distances and valid paths: " << (ok ? "yes" : "NO") << endl;
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Preprocessing → bounded witness searches per contracted vertex, divided among the threads
+// Query         → two small upward Dijkstra searches + path length for unpacking
+
+// 🧠 Space Complexity (SC):
+// O(V + E + shortcuts) for the hierarchy, O(V) per query object
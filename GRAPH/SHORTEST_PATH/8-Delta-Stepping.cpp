@@ -0,0 +1,123 @@
+// 🧵 Delta-stepping: parallel SSSP (delta_stepping.h)
+// Dijkstra is serial around its priority queue: one vertex is settled per step.
+// Delta-stepping settles a whole BUCKET of vertices per step (all tentative distances within
+// delta of each other) and lets the threads relax their edges in parallel:
+//   light edges (w ≤ delta) → may refill the current bucket, repeated until it stays empty
+//   heavy edges (w > delta) → relaxed once per settled vertex, always into later buckets
+// Distance updates are atomicMin (CAS loop), so races only ever lower a distance.
+
+// 🎛 delta trades work for parallelism:
+//   small delta → buckets are thin, little repeated work, but many barrier-separated rounds
+//   large delta → fat buckets keep all threads busy, but vertices get improved several times
+
+// Usage: ./a.out [grid side = 1000] [rmat scale = 18] [sources = 3]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+#include "../CORE/parallel.h"
+#include "dijkstra.h"
+#include "delta_stepping.h"
+using namespace std;
+
+void benchmark(const string& name, const CSRGraph& g, int numSources) {
+    vector<int> sources;
+    for (int i = 0; i < numSources; i++) sources.push_back((int)((i * 2654435761LL + 99) % g.V));
+
+    // Reference: serial Dijkstra
+    vector<vector<int>> expected(numSources);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < numSources; i++) dijkstraWith<BinaryHeapQueue>(sources[i], g, expected[i]);
+    double dijkstraMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / numSources;
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+    int suggested = suggestedDelta(g);
+    cout << endl << name << " (V = " << g.V << ", E = " << g.numEdges() << ", max weight "
+         << maxEdgeWeight(g) << "), Dijkstra " << fixed << setprecision(1) << dijkstraMs << " ms" << endl;
+
+    // 🎛 Delta sweep with all threads
+    ThreadPool all(maxThreads);
+    cout << "Delta sweep, " << maxThreads << " threads:" << endl;
+    cout << setw(10) << "delta" << setw(10) << "ms" << setw(10) << "buckets" << setw(10) << "phases"
+         << setw(14) << "relax/edge" << setw(8) << "same" << endl;
+    for (int delta : {1, max(1, suggested / 4), suggested, suggested * 4, suggested * 32}) {
+        DeltaSteppingStats stats, total;
+        vector<vector<int>> dist(numSources);
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < numSources; i++) {
+            deltaStepping(sources[i], g, dist[i], all, delta, &stats);
+            total.buckets += stats.buckets;
+            total.lightPhases += stats.lightPhases;
+            total.relaxations += stats.relaxations;
+        }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / numSources;
+        bool same = dist == expected;   // Checked after the clock stops
+        cout << setw(10) << delta << setw(10) << ms << setw(10) << total.buckets / numSources
+             << setw(10) << total.lightPhases / numSources
+             << setw(14) << setprecision(2) << (double)total.relaxations / numSources / g.numEdges()
+             << setprecision(1) << setw(8) << (same ? "yes" : "NO") << endl;
+    }
+
+    // 📈 Strong scaling: same graph, same delta, 1, 2, 4, ... up to all cores
+    vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    cout << "Strong scaling, delta = " << suggested << ":" << endl;
+    cout << setw(10) << "threads" << setw(10) << "ms" << setw(10) << "speedup" << setw(14) << "vs Dijkstra"
+         << setw(8) << "same" << endl;
+    double baseMs = 0;
+    for (int T : threadCounts) {
+        ThreadPool team(T);
+        vector<vector<int>> dist(numSources);
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < numSources; i++) deltaStepping(sources[i], g, dist[i], team, suggested);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / numSources;
+        bool same = dist == expected;
+        if (T == 1) baseMs = ms;
+        cout << setw(10) << T << setw(10) << ms << setw(10) << setprecision(2) << baseMs / ms
+             << setw(14) << dijkstraMs / ms << setprecision(1) << setw(8) << (same ? "yes" : "NO") << endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    // Small example: same graph as 1-Dijkstra’s-Algo.cpp
+    vector<Edge> edges = {
+        {0, 1, 10}, {0, 4, 5}, {1, 2, 1}, {1, 4, 2}, {2, 3, 4},
+        {3, 0, 7}, {4, 1, 3}, {4, 2, 9}, {4, 3, 2}
+    };
+    ThreadPool pool;
+    vector<int> dist;
+    deltaStepping(0, buildCSR(5, edges), dist, pool, 3);
+    cout << "Shortest distances from node 0 (delta-stepping, delta = 3): ";
+    for (int d : dist) cout << d << " ";
+    cout << endl;
+
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    int scale = argc > 2 ? atoi(argv[2]) : 18;
+    int numSources = argc > 3 ? atoi(argv[3]) : 3;
+
+    // Road-like: long distances, many thin buckets
+    benchmark("Grid " + to_string(side) + " x " + to_string(side),
+              buildCSR(side * side, gridEdges(side, side, 17, 100), false), numSources);
+    // Power-law: small diameter, few fat buckets
+    benchmark("RMAT scale " + to_string(scale) + ", edge factor 16",
+              buildCSR(1 << scale, rmatEdges(scale, 16, 5, 1000), false), numSources);
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Dijkstra        → O((V + E) log V), serial
+// Delta-stepping  → O(V + E + re-relaxations) work, spread over the threads;
+//                   one set of barriers per light phase / bucket
+
+// 🧠 Space Complexity (SC):
+// O(V) atomic distances + bucket entries (at most one per successful relaxation)
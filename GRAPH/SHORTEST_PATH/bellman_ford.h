@@ -0,0 +1,51 @@
+// 📚 Bellman-Ford on the shared CSR graph (explained and demonstrated in 2-Bellman-Ford-Algo.cpp).
+// Kept in a header so other programs (benchmarks) call the very same code.
+
+#pragma once
+
+#include <vector>
+#include <climits>
+#include "../CORE/csr_graph.h"
+using namespace std;
+
+// Bellman-Ford on a weighted CSR graph
+// Returns false if a negative weight cycle is reachable from src
+inline bool bellmanFord(const CSRGraph& g, int src, vector<int>& dist) {
+    int V = g.V;
+
+    // Step 1: Initialize distances from source to all vertices as infinity
+    dist.assign(V, INT_MAX);
+    dist[src] = 0;
+
+    // Step 2: Relax all edges (V - 1) times
+    // This ensures shortest distances are computed considering all possible paths
+    for (int i = 1; i <= V - 1; i++) {
+        for (int u = 0; u < V; u++) {
+            if (dist[u] == INT_MAX) continue;   // Nothing to relax from an unreachable node
+
+            for (int j = g.offsets[u]; j < g.offsets[u + 1]; j++) {
+                int v = g.adj[j];
+                int wt = g.weights[j];
+
+                // If a shorter path to v is found through u
+                if (dist[u] + wt < dist[v]) {
+                    dist[v] = dist[u] + wt;
+                }
+            }
+        }
+    }
+
+    // Step 3: Check for negative weight cycles
+    for (int u = 0; u < V; u++) {
+        if (dist[u] == INT_MAX) continue;
+
+        for (int j = g.offsets[u]; j < g.offsets[u + 1]; j++) {
+            // If we can still relax an edge, then a negative cycle exists
+            if (dist[u] + g.weights[j] < dist[g.adj[j]]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,637 @@
+// 🏔 Contraction Hierarchies (CH): preprocess once, answer s → t queries by searching only a few
+// hundred vertices (explained and benchmarked in 7-Contraction-Hierarchies.cpp)
+// Preprocessing removes ("contracts") the vertices one by one, least important first. When v is
+// removed, every path u → v → w that might be a shortest path is kept as a SHORTCUT edge u → w
+// with weight w(u, v) + w(v, w). It is only needed if no other path u ⇝ w of at most that length
+// avoids v: a small bounded Dijkstra from u (the WITNESS search) checks that.
+// The contraction order is the rank of a vertex. Every edge of the final search graph (original
+// edges + shortcuts) goes from lower to higher rank in one of two CSRs:
+//   upward   → u → x with rank[x] > rank[u]                        (forward search from s)
+//   downward → at x: the sources y of edges y → x with rank[y] > rank[x] (backward search from t)
+// A query is a bidirectional Dijkstra that only climbs: forward from s on upward, backward from t
+// on downward. Both meet at the highest-ranked vertex of some shortest path, after settling only
+// a few hundred vertices even on continent-sized road networks.
+
+// 📊 Importance of v = 2 * edge difference (shortcuts added - edges removed if v is contracted now)
+//                      + number of already contracted neighbors (spreads contraction evenly).
+// 🧵 Parallel preprocessing in rounds: every vertex whose (importance, id) is smaller than that of
+// all its remaining neighbors is contracted in the same round (an independent set, so no shortcut
+// ever starts or ends at another vertex of the round). Their witness searches run in parallel on
+// the unchanged graph, then the shortcuts are inserted and the importance of the neighbors is
+// recomputed, again in parallel (or, with lazy updates, only when they next become candidates). A witness may pass through another vertex of the same round, so
+// it has to be STRICTLY shorter than u → v → w: two vertices with equally long detours through
+// each other would otherwise both drop their shortcut.
+// 💾 save() / load() keep the result on disk together with the checksum of the input graph,
+// so preprocessing runs once per graph version.
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <numeric>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "../CORE/graph_file.h"   // graphChecksum
+#include "../CORE/parallel.h"
+#include "dijkstra_queues.h"      // IndexedDaryHeap
+#include "point_to_point.h"       // PathResult
+using namespace std;
+
+const uint32_t CH_FILE_VERSION = 1;
+
+struct CHFileHeader {
+    char magic[8];             // "CHGRAPH\0"
+    uint32_t version;          // CH_FILE_VERSION
+    uint32_t reserved0;
+    uint64_t numVertices;
+    uint64_t numUp, numDown;   // Edges in the upward / downward CSR
+    uint64_t sourceChecksum;   // graphChecksum() of the graph the hierarchy was built from
+    uint64_t checksum;         // Of everything after the header
+    uint8_t reserved[8];
+};
+static_assert(sizeof(CHFileHeader) == 64, "CH file header must be 64 bytes");
+
+// Edge of the graph under contraction
+struct CHEdge {
+    int to, weight;
+    int via;   // Middle vertex of a shortcut, -1 for an original edge
+};
+
+struct CHShortcut {
+    int from, to, weight, via;
+};
+
+// Bounded Dijkstra state of one thread (stamped distances: a search only pays for what it touches)
+struct WitnessSearch {
+    vector<int> dist, hops, stamp;
+    vector<int> targetStamp;   // targetStamp[w] == gen → w is one of the out-neighbors being checked
+    int gen = 0;
+    IndexedDaryHeap<4> heap;
+
+    explicit WitnessSearch(const CSRGraph& g) : dist(g.V), hops(g.V), stamp(g.V, 0), targetStamp(g.V, 0), heap(g) {}
+
+    void start() {
+        if (++gen == 0) {
+            fill(stamp.begin(), stamp.end(), 0);
+            fill(targetStamp.begin(), targetStamp.end(), 0);
+            gen = 1;
+        }
+        heap.clear();
+    }
+    int get(int v) const { return stamp[v] == gen ? dist[v] : INT_MAX; }
+    void set(int v, int d, int h) {
+        dist[v] = d;
+        hops[v] = h;
+        stamp[v] = gen;
+    }
+};
+
+// The graph being contracted (adjacency lists that change) + the contraction loop
+class CHPreprocessor {
+public:
+    CHPreprocessor(const CSRGraph& g, int witnessLimit, int hopLimit, bool lazyUpdates)
+        : g(g), V(g.V), witnessLimit(witnessLimit), hopLimit(hopLimit), lazyUpdates(lazyUpdates), outEdges(V), inEdges(V),
+          contracted(V, 0), stale(V, 0), importance(V, 0), edgeDifference(V, 0), deletedNeighbors(V, 0),
+          rank(V, -1), upEdges(V), downEdges(V) {
+        for (int u = 0; u < V; u++) {
+            for (int i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+                int w = g.isWeighted() ? g.weights[i] : 1;
+                if (g.adj[i] != u) addEdge(u, g.adj[i], w, -1);   // Self-loops never help
+            }
+        }
+    }
+
+    // Contract every vertex. Afterwards rank[], upEdges[] and downEdges[] describe the hierarchy.
+    void run(ThreadPool& pool) {
+        vector<WitnessSearch> ws;
+        ws.reserve(pool.size());
+        for (int t = 0; t < pool.size(); t++) ws.emplace_back(g);
+
+        vector<int> remaining(V);
+        iota(remaining.begin(), remaining.end(), 0);
+        updateImportance(remaining, pool, ws);
+
+        vector<char> pick, touched(V, 0);
+        vector<vector<CHShortcut>> found(pool.size());
+        int nextRank = 0;
+        while (!remaining.empty()) {
+            rounds++;
+
+            // 1. Independent set: local minimums of (importance, id). With lazy updates a candidate
+            //    whose neighborhood changed since its last simulation is simulated again first, and
+            //    only contracted if it is still a local minimum with the fresh value.
+            pick.assign(remaining.size(), 0);
+            forEach(pool, remaining.size(), 256, [&](int, size_t i) { pick[i] = isLocalMin(remaining[i]); });
+            vector<int> candidates, refresh, batch;
+            for (size_t i = 0; i < remaining.size(); i++) {
+                if (!pick[i]) continue;
+                candidates.push_back(remaining[i]);
+                if (stale[remaining[i]]) refresh.push_back(remaining[i]);
+            }
+            updateImportance(refresh, pool, ws);
+            for (int v : candidates) {
+                if (isLocalMin(v)) batch.push_back(v);
+            }
+            for (int v : batch) rank[v] = nextRank++;
+
+            // 2. Witness searches of the whole batch in parallel (the graph is read-only here)
+            for (auto& buf : found) buf.clear();
+            forEach(pool, batch.size(), 16, [&](int tid, size_t i) { contract(batch[i], ws[tid], &found[tid]); });
+
+            // 3. Freeze the edges of the batch, unlink it, insert the shortcuts
+            vector<int> neighbors;
+            for (int v : batch) removeVertex(v, touched, neighbors);
+            for (auto& buf : found) {
+                for (const CHShortcut& s : buf) addEdge(s.from, s.to, s.weight, s.via);
+            }
+
+            // 4. Only the neighbors of the batch changed: simulate them again now, or (lazy) only
+            //    update the cheap term and leave the simulation for when they become candidates
+            for (int x : neighbors) touched[x] = 0;
+            if (lazyUpdates) {
+                for (int x : neighbors) {
+                    stale[x] = 1;
+                    importance[x] = 2 * edgeDifference[x] + deletedNeighbors[x];
+                }
+            } else {
+                updateImportance(neighbors, pool, ws);
+            }
+
+            size_t kept = 0;
+            for (int v : remaining) {
+                if (!contracted[v]) remaining[kept++] = v;
+            }
+            remaining.resize(kept);
+        }
+    }
+
+    const CSRGraph& g;
+    int V, witnessLimit, hopLimit;
+    bool lazyUpdates;
+    int rounds = 0;
+    long long simulations = 0;                  // Simulated contractions (importance updates)
+    vector<vector<CHEdge>> outEdges, inEdges;   // Remaining graph: inEdges[x] holds y for y → x
+    vector<char> contracted, stale;             // stale[v]: edgeDifference[v] predates a neighbor's contraction
+    vector<int> importance, edgeDifference, deletedNeighbors, rank;
+    vector<vector<CHEdge>> upEdges, downEdges;  // Frozen edges of contracted vertices
+
+private:
+    template <typename Body>
+    static void forEach(ThreadPool& pool, size_t n, int chunk, Body body) {
+        ChunkQueue work;
+        work.reset(n, chunk);
+        pool.run([&](int tid) {
+            long long begin, end;
+            while (work.grab(begin, end)) {
+                for (long long i = begin; i < end; i++) body(tid, (size_t)i);
+            }
+        });
+    }
+
+    // Insert u → w, or lower its weight if the edge already exists (keeps one edge per pair)
+    void addEdge(int u, int w, int weight, int via) {
+        for (CHEdge& e : outEdges[u]) {
+            if (e.to != w) continue;
+            if (weight < e.weight) {
+                e.weight = weight;
+                e.via = via;
+                for (CHEdge& r : inEdges[w]) {
+                    if (r.to == u) {
+                        r.weight = weight;
+                        r.via = via;
+                    }
+                }
+            }
+            return;
+        }
+        outEdges[u].push_back({w, weight, via});
+        inEdges[w].push_back({u, weight, via});
+    }
+
+    static void eraseEdgeTo(vector<CHEdge>& list, int v) {
+        for (size_t i = 0; i < list.size(); i++) {
+            if (list[i].to == v) {
+                list[i] = list.back();
+                list.pop_back();
+                return;
+            }
+        }
+    }
+
+    // v's remaining edges all lead to higher ranks → they become its search graph edges
+    void removeVertex(int v, vector<char>& touched, vector<int>& neighbors) {
+        contracted[v] = 1;
+        upEdges[v] = move(outEdges[v]);
+        downEdges[v] = move(inEdges[v]);
+        outEdges[v] = {};
+        inEdges[v] = {};
+        for (const CHEdge& e : upEdges[v]) {
+            eraseEdgeTo(inEdges[e.to], v);
+            deletedNeighbors[e.to]++;
+            if (!touched[e.to]) {
+                touched[e.to] = 1;
+                neighbors.push_back(e.to);
+            }
+        }
+        for (const CHEdge& e : downEdges[v]) {
+            eraseEdgeTo(outEdges[e.to], v);
+            deletedNeighbors[e.to]++;
+            if (!touched[e.to]) {
+                touched[e.to] = 1;
+                neighbors.push_back(e.to);
+            }
+        }
+    }
+
+    bool isLocalMin(int v) const {
+        for (const vector<CHEdge>* list : {&outEdges[v], &inEdges[v]}) {
+            for (const CHEdge& e : *list) {
+                int x = e.to;
+                if (importance[x] < importance[v] || (importance[x] == importance[v] && x < v)) return false;
+            }
+        }
+        return true;
+    }
+
+    void updateImportance(const vector<int>& vertices, ThreadPool& pool, vector<WitnessSearch>& ws) {
+        simulations += vertices.size();
+        forEach(pool, vertices.size(), 64, [&](int tid, size_t i) {
+            int v = vertices[i];
+            edgeDifference[v] = contract(v, ws[tid], nullptr) - (int)(outEdges[v].size() + inEdges[v].size());
+            importance[v] = 2 * edgeDifference[v] + deletedNeighbors[v];
+            stale[v] = 0;
+        });
+    }
+
+    // Dijkstra from source over the remaining graph except `skip`. Stops once all `targets` marked in
+    // ws.targetStamp are settled, past `limit`, or after witnessLimit settled vertices, and never
+    // extends a path beyond hopLimit edges (every label found so far is still the length of a real
+    // path, so an early stop only costs extra shortcuts)
+    void witnessSearch(int source, int skip, int limit, int targets, WitnessSearch& ws) const {
+        ws.set(source, 0, 0);
+        ws.heap.push(0, source);
+        int settled = 0;
+        while (!ws.heap.empty() && targets > 0) {
+            pair<int, int> top = ws.heap.pop();
+            int d = top.first, u = top.second;
+            if (d > limit || ++settled > witnessLimit) break;
+            if (ws.targetStamp[u] == ws.gen) targets--;
+            if (ws.hops[u] >= hopLimit) continue;
+            for (const CHEdge& e : outEdges[u]) {
+                int x = e.to;
+                if (x == skip) continue;
+                if (d + e.weight < ws.get(x)) {
+                    ws.set(x, d + e.weight, ws.hops[u] + 1);
+                    ws.heap.push(d + e.weight, x);
+                }
+            }
+        }
+    }
+
+    // Shortcuts needed if v were contracted now (appended to `shortcuts` when given), returns the count
+    int contract(int v, WitnessSearch& ws, vector<CHShortcut>* shortcuts) const {
+        int count = 0;
+        for (const CHEdge& in : inEdges[v]) {
+            int u = in.to;
+            ws.start();
+            int limit = -1, targets = 0;
+            for (const CHEdge& out : outEdges[v]) {
+                if (out.to == u) continue;
+                limit = max(limit, in.weight + out.weight);
+                ws.targetStamp[out.to] = ws.gen;
+                targets++;
+            }
+            if (targets == 0) continue;
+
+            witnessSearch(u, v, limit, targets, ws);
+            for (const CHEdge& out : outEdges[v]) {
+                if (out.to == u) continue;
+                int viaV = in.weight + out.weight;
+                if (ws.get(out.to) >= viaV) {   // No strictly shorter witness: keep u → v → w
+                    count++;
+                    if (shortcuts) shortcuts->push_back({u, out.to, viaV, v});
+                }
+            }
+        }
+        return count;
+    }
+};
+
+class ContractionHierarchy {
+public:
+    int witnessLimit;   // Settled vertices per witness search (smaller → faster build, more shortcuts)
+    int hopLimit;       // Edges per witness path (same trade-off)
+    bool lazyUpdates;   // Re-simulate a vertex only when it is about to be contracted (fewer simulations,
+                        // but the order is built from outdated importances → usually more shortcuts)
+
+    explicit ContractionHierarchy(int witnessLimit = 500, int hopLimit = INT_MAX, bool lazyUpdates = false)
+        : witnessLimit(witnessLimit), hopLimit(hopLimit), lazyUpdates(lazyUpdates) {}
+
+    // Preprocess g (non-negative weights, unweighted → 1; undirected graphs store both directions)
+    void build(const CSRGraph& g, ThreadPool& pool) {
+        V = g.V;
+        sourceChecksum = graphChecksum(g);
+        CHPreprocessor pre(g, witnessLimit, hopLimit, lazyUpdates);
+        pre.run(pool);
+        numRounds = pre.rounds;
+        numSimulations = pre.simulations;
+        rank = move(pre.rank);
+        toCSR(pre.upEdges, up, upVia);
+        toCSR(pre.downEdges, down, downVia);
+    }
+
+    // 💾 Binary file: CHFileHeader, then rank (V ints) and for upward, downward:
+    //    offsets (V + 1), adj, weights, via (numUp / numDown ints each)
+    bool save(const string& path, string& error) const {
+        CHFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, "CHGRAPH", 8);
+        header.version = CH_FILE_VERSION;
+        header.numVertices = V;
+        header.numUp = up.numEdges();
+        header.numDown = down.numEdges();
+        header.sourceChecksum = sourceChecksum;
+        header.checksum = payloadChecksum();
+
+        FILE* f = fopen(path.c_str(), "wb");
+        if (!f) {
+            error = "cannot create " + path;
+            return false;
+        }
+        bool ok = fwrite(&header, sizeof(header), 1, f) == 1 && writeInts(f, rank.data(), rank.size());
+        for (const CSRGraph* gr : {&up, &down}) {
+            const vector<int>& via = gr == &up ? upVia : downVia;
+            ok = ok && writeInts(f, gr->offsets.data(), gr->offsets.size())
+                    && writeInts(f, gr->adj.data(), gr->adj.size())
+                    && writeInts(f, gr->weights.data(), gr->weights.size())
+                    && writeInts(f, via.data(), via.size());
+        }
+        ok = (fclose(f) == 0) && ok;
+        if (!ok) error = "write failed for " + path;
+        return ok;
+    }
+
+    // Load a hierarchy saved for exactly this graph (fails if g changed since, or the file is damaged)
+    bool load(const string& path, const CSRGraph& g, string& error) {
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) {
+            error = "cannot open " + path;
+            return false;
+        }
+        CHFileHeader header;
+        error.clear();
+        if (fread(&header, sizeof(header), 1, f) != 1 || memcmp(header.magic, "CHGRAPH", 8) != 0) {
+            error = path + " is not a contraction hierarchy file";
+        } else if (header.version != CH_FILE_VERSION) {
+            error = path + " has unsupported version " + to_string(header.version);
+        } else if (header.numVertices != (uint64_t)g.V || header.sourceChecksum != graphChecksum(g)) {
+            error = path + " was built for a different graph";
+        } else if (header.numUp > INT32_MAX || header.numDown > INT32_MAX) {
+            error = path + " has inconsistent sizes";
+        }
+
+        V = g.V;
+        bool ok = error.empty() && readInts(f, rank, V)
+               && readCSR(f, up, upVia, header.numUp) && readCSR(f, down, downVia, header.numDown);
+        fclose(f);
+        if (error.empty() && !ok) error = path + " is truncated";
+        if (error.empty() && payloadChecksum() != header.checksum) error = path + " failed the checksum";
+        if (!error.empty()) {
+            *this = ContractionHierarchy(witnessLimit, hopLimit, lazyUpdates);
+            return false;
+        }
+        sourceChecksum = header.sourceChecksum;
+        numRounds = 0;
+        numSimulations = 0;
+        return true;
+    }
+
+    int numVertices() const { return V; }
+    int rankOf(int v) const { return rank[v]; }
+    int rounds() const { return numRounds; }   // Parallel contraction rounds of the last build
+    long long simulations() const { return numSimulations; }   // Importance updates of the last build
+    const CSRGraph& upward() const { return up; }
+    const CSRGraph& downward() const { return down; }
+
+    // Middle vertex of upward edge i / downward edge i (-1 for an original edge)
+    int viaUp(int i) const { return upVia[i]; }
+    int viaDown(int i) const { return downVia[i]; }
+
+    // Index of edge u → x in upward(u), of edge y → x in downward(x); -1 if absent
+    int findUp(int u, int x) const { return find(up, u, x); }
+    int findDown(int x, int y) const { return find(down, x, y); }
+
+    long long numShortcuts() const {
+        long long count = 0;
+        for (int via : upVia) count += via != -1;
+        for (int via : downVia) count += via != -1;
+        return count;
+    }
+
+    size_t memoryBytes() const {
+        return (rank.size() + up.offsets.size() + down.offsets.size()
+                + 3 * (size_t)(up.numEdges() + down.numEdges())) * sizeof(int);
+    }
+
+private:
+    static void toCSR(vector<vector<CHEdge>>& lists, CSRGraph& gr, vector<int>& via) {
+        gr = CSRGraph();
+        gr.V = (int)lists.size();
+        gr.offsets.assign(gr.V + 1, 0);
+        for (int u = 0; u < gr.V; u++) gr.offsets[u + 1] = gr.offsets[u] + (int)lists[u].size();
+        gr.adj.reserve(gr.offsets[gr.V]);
+        gr.weights.reserve(gr.offsets[gr.V]);
+        via.clear();
+        via.reserve(gr.offsets[gr.V]);
+        for (auto& list : lists) {
+            for (const CHEdge& e : list) {
+                gr.adj.push_back(e.to);
+                gr.weights.push_back(e.weight);
+                via.push_back(e.via);
+            }
+            list = {};   // Free as we go
+        }
+    }
+
+    static int find(const CSRGraph& gr, int u, int x) {
+        for (int i = gr.offsets[u]; i < gr.offsets[u + 1]; i++) {
+            if (gr.adj[i] == x) return i;
+        }
+        return -1;
+    }
+
+    uint64_t payloadChecksum() const {
+        uint64_t h = graphChecksum(rank.data(), rank.size() * sizeof(int));
+        h = csrChecksum(up, h);
+        h = graphChecksum(upVia.data(), upVia.size() * sizeof(int), h);
+        h = csrChecksum(down, h);
+        return graphChecksum(downVia.data(), downVia.size() * sizeof(int), h);
+    }
+
+    static uint64_t csrChecksum(const CSRGraph& gr, uint64_t h) {
+        h = graphChecksum(gr.offsets.data(), gr.offsets.size() * sizeof(int), h);
+        h = graphChecksum(gr.adj.data(), gr.adj.size() * sizeof(int), h);
+        return graphChecksum(gr.weights.data(), gr.weights.size() * sizeof(int), h);
+    }
+
+    static bool writeInts(FILE* f, const int* data, size_t n) {
+        return n == 0 || fwrite(data, sizeof(int), n, f) == n;
+    }
+
+    static bool readInts(FILE* f, vector<int>& out, size_t n) {
+        out.resize(n);
+        return n == 0 || fread(out.data(), sizeof(int), n, f) == n;
+    }
+
+    static bool readInts(FILE* f, GraphArray& out, size_t n) {
+        out.resize(n);
+        return n == 0 || fread(&out[0], sizeof(int), n, f) == n;
+    }
+
+    bool readCSR(FILE* f, CSRGraph& gr, vector<int>& via, uint64_t m) {
+        gr = CSRGraph();
+        gr.V = V;
+        if (!readInts(f, gr.offsets, V + 1) || !readInts(f, gr.adj, m)
+            || !readInts(f, gr.weights, m) || !readInts(f, via, m)) return false;
+        return gr.offsets[0] == 0 && gr.offsets[V] == (int)m;
+    }
+
+    int V = 0;
+    int numRounds = 0;
+    long long numSimulations = 0;
+    uint64_t sourceChecksum = 0;
+    vector<int> rank;             // Contraction order
+    CSRGraph up, down;
+    vector<int> upVia, downVia;   // Middle vertex per edge (shortcut unpacking)
+};
+
+// Query engine: reusable per thread (labels are stamped, nothing is cleared between queries)
+class CHQuery {
+public:
+    explicit CHQuery(const ContractionHierarchy& ch)
+        : ch(ch), heap{IndexedDaryHeap<4>(ch.upward()), IndexedDaryHeap<4>(ch.upward())} {
+        for (int side = 0; side < 2; side++) {
+            dist[side].resize(ch.numVertices());
+            parent[side].resize(ch.numVertices());
+            parentEdge[side].resize(ch.numVertices());
+            stamp[side].assign(ch.numVertices(), 0);
+        }
+    }
+
+    // Distance and (if unpackPath) the original path s → ... → t; settled counts both searches
+    PathResult query(int s, int t, bool unpackPath = true) {
+        PathResult res;
+        if (++gen == 0) {
+            for (auto& st : stamp) fill(st.begin(), st.end(), 0);
+            gen = 1;
+        }
+        heap[0].clear();
+        heap[1].clear();
+        label(0, s, 0, -1, -1);
+        label(1, t, 0, -1, -1);
+        heap[0].push(0, s);
+        heap[1].push(0, t);
+
+        int best = INT_MAX, meet = -1;
+        bool active[2] = {true, true};
+        int side = 1;
+        while (active[0] || active[1]) {
+            side = active[1 - side] ? 1 - side : side;   // Alternate while both are running
+            if (heap[side].empty()) {
+                active[side] = false;
+                continue;
+            }
+            pair<int, int> top = heap[side].pop();
+            int d = top.first, u = top.second;
+            if (d >= best) {          // Nothing left on this side can improve the answer
+                active[side] = false;
+                continue;
+            }
+            res.settled++;
+            if (has(1 - side, u) && d + dist[1 - side][u] < best) {
+                best = d + dist[1 - side][u];
+                meet = u;
+            }
+
+            const CSRGraph& gr = side == 0 ? ch.upward() : ch.downward();
+            const CSRGraph& other = side == 0 ? ch.downward() : ch.upward();
+
+            // Stall-on-demand: a higher neighbor already reaches u more cheaply, so d is not
+            // u's true distance and nothing found from u can lie on a shortest path
+            bool stalled = false;
+            for (int i = other.offsets[u]; i < other.offsets[u + 1] && !stalled; i++) {
+                int x = other.adj[i];
+                stalled = has(side, x) && dist[side][x] + other.weights[i] < d;
+            }
+            if (stalled) continue;
+
+            for (int i = gr.offsets[u]; i < gr.offsets[u + 1]; i++) {
+                int x = gr.adj[i];
+                int nd = d + gr.weights[i];
+                if (!has(side, x) || nd < dist[side][x]) {
+                    label(side, x, nd, u, i);
+                    heap[side].push(nd, x);
+                }
+            }
+        }
+
+        if (meet != -1) {
+            res.dist = best;
+            if (unpackPath) buildPath(s, t, meet, res.path);
+        }
+        return res;
+    }
+
+private:
+    bool has(int side, int v) const { return stamp[side][v] == gen; }
+
+    void label(int side, int v, int d, int p, int edge) {
+        dist[side][v] = d;
+        parent[side][v] = p;
+        parentEdge[side][v] = edge;
+        stamp[side][v] = gen;
+    }
+
+    // s ⇝ meet along upward edges, meet ⇝ t along downward edges, every shortcut expanded
+    void buildPath(int s, int t, int meet, vector<int>& path) const {
+        vector<int> climb;
+        for (int v = meet; v != s; v = parent[0][v]) climb.push_back(v);
+        path.push_back(s);
+        for (size_t i = climb.size(); i-- > 0;) {
+            int v = climb[i];
+            unpack(parent[0][v], v, ch.viaUp(parentEdge[0][v]), path);
+        }
+        for (int v = meet; v != t; v = parent[1][v]) unpack(v, parent[1][v], ch.viaDown(parentEdge[1][v]), path);
+    }
+
+    // Append the original vertices of edge a → b after a (shortcut a → via → b is expanded recursively;
+    // via was contracted before a and b, so a → via is a downward edge of via, via → b an upward one)
+    void unpack(int a, int b, int via, vector<int>& path) const {
+        if (via == -1) {
+            path.push_back(b);
+            return;
+        }
+        unpack(a, via, ch.viaDown(ch.findDown(via, a)), path);
+        unpack(via, b, ch.viaUp(ch.findUp(via, b)), path);
+    }
+
+    const ContractionHierarchy& ch;
+    IndexedDaryHeap<4> heap[2];   // 0 = forward from s (upward), 1 = backward from t (downward)
+    vector<int> dist[2], parent[2], parentEdge[2], stamp[2];
+    int gen = 0;
+};
+
+
+// ⏱ Time Complexity (TC):
+// Preprocessing → one bounded witness search per (in-neighbor, contracted vertex), repeated when
+//                 importances are updated; depends on the graph (near-linear on road networks,
+//                 ~10-12 s and more shortcuts than edges on a 300 x 300 grid with one thread)
+// Query         → Dijkstra on the two upward search spaces (hundreds of vertices on road networks),
+//                 + O(path length) to unpack shortcuts
+
+// 🧠 Space Complexity (SC):
+// O(V + E + shortcuts) for the hierarchy; O(V) per CHQuery (allocated once, reused)
@@ -0,0 +1,223 @@
+// 🧵 Delta-stepping: parallel single-source shortest paths (explained and benchmarked in 8-Delta-Stepping.cpp)
+// Dijkstra settles ONE vertex at a time (the queue minimum), so it cannot be split among threads.
+// Delta-stepping relaxes the ordering: tentative distances are grouped into buckets of width delta,
+//   bucket i = vertices with dist in [i * delta, (i + 1) * delta)
+// and all vertices of the smallest non-empty bucket are processed at once, in parallel:
+//   1. Light edges (w ≤ delta) can put a vertex back into the SAME bucket, so they are relaxed in
+//      phases until the bucket stays empty (each phase = the vertices that entered it last time).
+//   2. Then every vertex that passed through the bucket has its final distance, and its heavy
+//      edges (w > delta) are relaxed once: they always land in a later bucket.
+// Distances are updated with atomicMin, so several threads may relax edges into the same vertex.
+// delta = 1 (integer weights) behaves like Dijkstra (little parallelism per bucket);
+// delta = ∞ is Bellman-Ford-like (one bucket, lots of parallelism, lots of repeated work).
+
+// 🔧 Every thread keeps its own bins ((vertex, distance) entries per bucket), so inserting needs
+// no lock. An entry is only processed if the vertex still has that distance, so entries made stale
+// by a later improvement are skipped.
+// The bins are not indexed by absolute bucket number (max distance / delta can be huge when delta
+// is small and weights are large). Only a window of R open buckets [base, base + R) is an array;
+// entries further ahead go to a per-thread overflow list. When the window is used up, it jumps to
+// the smallest overflow bucket and the overflow entries that now fit are moved into it.
+// R = max weight / delta + 1 never overflows (every new entry is within max weight of the current
+// bucket), capped at DELTA_MAX_OPEN_BUCKETS.
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <climits>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "dijkstra_queues.h"   // maxEdgeWeight
+using namespace std;
+
+struct DeltaSteppingStats {
+    long long buckets = 0;       // Non-empty buckets processed
+    long long lightPhases = 0;   // Light-edge phases over all buckets
+    long long relaxations = 0;   // Successful distance updates (Dijkstra: ≤ one per edge)
+};
+
+// Starting point for delta: about one average edge weight per unit of average degree
+inline int suggestedDelta(const CSRGraph& g) {
+    int avgDegree = max(1, g.numEdges() / max(1, g.V));
+    return max(1, maxEdgeWeight(g) / avgDegree);
+}
+
+// Most open buckets per thread (empty vectors: 384 KiB); further buckets wait in the overflow list
+const int DELTA_MAX_OPEN_BUCKETS = 1 << 14;
+
+// Shortest distances from start on a weighted CSR graph (non-negative weights), same result as
+// dijkstra(): INT_MAX for unreachable vertices. Returns false (distOut untouched) if delta < 1.
+inline bool deltaStepping(int start, const CSRGraph& graph, vector<int>& distOut, ThreadPool& pool,
+                          int delta, DeltaSteppingStats* stats = nullptr) {
+    if (delta < 1) return false;
+    typedef pair<int, int> Entry;   // (vertex, distance when inserted)
+    int n = graph.V;
+    int T = pool.size();
+    int R = (int)min<long long>(maxEdgeWeight(graph) / delta + 1, DELTA_MAX_OPEN_BUCKETS);
+
+    vector<atomic<int>> dist(n);
+    for (int v = 0; v < n; v++) dist[v].store(INT_MAX, memory_order_relaxed);
+    dist[start].store(0, memory_order_relaxed);
+
+    vector<int> lastBucket(n, -1);                  // Bucket in which v was last collected for heavy edges
+    vector<vector<vector<Entry>>> bins(T, vector<vector<Entry>>(R));   // bins[tid][bucket - base]
+    vector<vector<Entry>> overflow(T);              // Entries of buckets ≥ base + R
+    vector<vector<Entry>> outbox(T);                // Thread's share of the next frontier
+    vector<vector<int>> settled(T);                 // Vertices of the current bucket (heavy edges)
+    vector<long long> relaxed(T, 0);
+    vector<long long> nextBucket(T);
+    vector<Entry> frontier = {{start, 0}};
+    vector<int> settledAll;
+    ChunkQueue work;
+    work.reset(frontier.size());
+    Barrier barrier(T);
+    long long current = 0;   // Index of the bucket being processed
+    long long base = 0;      // First bucket of the open window
+    bool bucketDone = false, done = false;
+    DeltaSteppingStats local;
+
+    // Relax the edges of u (light or heavy ones) from distance d into this thread's bins
+    auto relax = [&](int tid, int u, int d, bool light, long long& count) {
+        for (int i = graph.offsets[u]; i < graph.offsets[u + 1]; i++) {
+            int weight = graph.weights[i];
+            if ((weight <= delta) != light) continue;
+            int v = graph.adj[i];
+            int nd = d + weight;
+            if (atomicMin(dist[v], nd)) {
+                long long b = nd / delta;   // ≥ current ≥ base
+                if (b < base + R) bins[tid][b - base].push_back({v, nd});
+                else overflow[tid].push_back({v, nd});
+                count++;
+            }
+        }
+    };
+
+    // Concatenate every thread's outbox into frontier (all threads call it)
+    auto gather = [&](int tid) {
+        barrier.wait();
+        if (tid == 0) {
+            frontier.resize(mergeSize(outbox));
+            work.reset(frontier.size());
+        }
+        barrier.wait();
+        copy(outbox[tid].begin(), outbox[tid].end(), frontier.begin() + mergeOffset(outbox, tid));
+        barrier.wait();
+    };
+
+    pool.run([&](int tid) {
+        long long count = 0;   // Successful relaxations of this thread (kept local: no shared counter)
+        while (true) {
+            // 1. Light phases until the current bucket stays empty
+            settled[tid].clear();
+            while (true) {
+                long long begin, end;
+                while (work.grab(begin, end)) {
+                    for (long long i = begin; i < end; i++) {
+                        int u = frontier[i].first, d = frontier[i].second;
+                        if (dist[u].load(memory_order_relaxed) != d) continue;   // Stale entry
+                        if (lastBucket[u] != current) {
+                            lastBucket[u] = current;
+                            settled[tid].push_back(u);
+                        }
+                        relax(tid, u, d, true, count);
+                    }
+                }
+                barrier.wait();   // All inserts of this phase are done
+
+                outbox[tid].clear();
+                outbox[tid].swap(bins[tid][current - base]);
+                gather(tid);
+                if (tid == 0) {
+                    local.lightPhases++;
+                    bucketDone = frontier.empty();
+                }
+                barrier.wait();
+                if (bucketDone) break;
+            }
+
+            // 2. Heavy edges of every vertex settled in this bucket (their distances are final now)
+            if (tid == 0) {
+                settledAll.resize(mergeSize(settled));
+                work.reset(settledAll.size());
+                local.buckets++;
+            }
+            barrier.wait();
+            copy(settled[tid].begin(), settled[tid].end(), settledAll.begin() + mergeOffset(settled, tid));
+            barrier.wait();
+            long long begin, end;
+            while (work.grab(begin, end)) {
+                for (long long i = begin; i < end; i++) {
+                    int u = settledAll[i];
+                    relax(tid, u, dist[u].load(memory_order_relaxed), false, count);
+                }
+            }
+            barrier.wait();
+
+            // 3. Next bucket: the smallest non-empty one in the window over all threads
+            nextBucket[tid] = LLONG_MAX;
+            for (long long b = current + 1; b < base + R; b++) {
+                if (!bins[tid][b - base].empty()) {
+                    nextBucket[tid] = b;
+                    break;
+                }
+            }
+            barrier.wait();
+            if (tid == 0) {
+                current = *min_element(nextBucket.begin(), nextBucket.end());
+                done = current == LLONG_MAX;
+            }
+            barrier.wait();
+
+            if (done) {
+                // Window used up: drop stale overflow entries, jump to the smallest overflow bucket
+                vector<Entry>& over = overflow[tid];
+                over.erase(remove_if(over.begin(), over.end(), [&](const Entry& e) {
+                    return dist[e.first].load(memory_order_relaxed) != e.second;
+                }), over.end());
+                nextBucket[tid] = LLONG_MAX;
+                for (const Entry& e : over) nextBucket[tid] = min(nextBucket[tid], (long long)(e.second / delta));
+                barrier.wait();
+                if (tid == 0) {
+                    current = base = *min_element(nextBucket.begin(), nextBucket.end());
+                    done = current == LLONG_MAX;
+                }
+                barrier.wait();
+                if (done) break;
+
+                // Move the entries that fall into the new window, keep the rest
+                size_t kept = 0;
+                for (const Entry& e : over) {
+                    long long b = e.second / delta;
+                    if (b < base + R) bins[tid][b - base].push_back(e);
+                    else over[kept++] = e;
+                }
+                over.resize(kept);
+            }
+
+            outbox[tid].clear();
+            outbox[tid].swap(bins[tid][current - base]);
+            gather(tid);
+        }
+        relaxed[tid] = count;
+    });
+
+    distOut.resize(n);
+    for (int v = 0; v < n; v++) distOut[v] = dist[v].load(memory_order_relaxed);
+    if (stats) {
+        for (long long r : relaxed) local.relaxations += r;
+        *stats = local;
+    }
+    return true;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Work: O(V + E) plus re-relaxations inside a bucket (grows with delta).
+// Span: one round of barriers per light phase and per bucket → about (max distance / delta)
+// buckets, so a small delta means little repeated work but many short, barrier-bound rounds.
+
+// 🧠 Space Complexity (SC):
+// O(V) distances + O(V + E) bin entries in the worst case (stale entries included)
+// + R ≤ DELTA_MAX_OPEN_BUCKETS open buckets per thread, independent of max distance / delta
@@ -0,0 +1,101 @@
+// 📚 Dijkstra on the shared CSR graph (explained and demonstrated in 1-Dijkstra’s-Algo.cpp).
+// Kept in a header so other programs (reordering pass, benchmarks) call the very same code.
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <climits>
+#include "../CORE/csr_graph.h"
+#include "dijkstra_queues.h"
+using namespace std;
+
+// Typedef for a pair representing (node, weight)
+typedef pair<int, int> pii;
+
+// Counters of one run (to compare queue policies)
+struct DijkstraStats {
+    long long pushes = 0;      // Entries inserted into the queue
+    long long pops = 0;        // Entries taken out
+    long long stalePops = 0;   // Popped entries whose distance had already been improved (skipped)
+    size_t maxQueueSize = 0;   // Largest number of entries in the queue at once
+};
+
+// Dijkstra's Algorithm on a weighted CSR graph with any queue policy from dijkstra_queues.h
+// (lazy-deletion queues or the decrease-key IndexedDaryHeap: the loop is the same).
+// The queue is passed in so repeated queries reuse its memory.
+// (dist is still reset in O(V) per call; for many small local queries see dijkstraLocal in sssp_workspace.h)
+template <typename Queue>
+void dijkstraWith(int start, const CSRGraph& graph, vector<int>& dist, Queue& pq, DijkstraStats* stats = nullptr) {
+    int n = graph.V;
+    DijkstraStats local;
+
+    // Initialize all distances to infinity
+    dist.assign(n, INT_MAX);
+    dist[start] = 0;
+
+    pq.clear();
+    pq.push(0, start);
+    local.pushes++;
+    local.maxQueueSize = 1;
+
+    while (!pq.empty()) {
+        pair<int, int> top = pq.pop();   // (distance, node) with the smallest distance
+        int current_dist = top.first;
+        int u = top.second;
+        local.pops++;
+
+        // If this path is longer than the already found shortest path, skip
+        if (current_dist > dist[u]) {
+            local.stalePops++;
+            continue;
+        }
+
+        // Traverse all neighbors of the current node
+        for (int i = graph.offsets[u]; i < graph.offsets[u + 1]; i++) {
+            int v = graph.adj[i];          // Neighbor node
+            int weight = graph.weights[i]; // Edge weight
+
+            // Relaxation step: if a shorter path to v is found
+            if (dist[v] > dist[u] + weight) {
+                dist[v] = dist[u] + weight;
+                pq.push(dist[v], v);
+                local.pushes++;
+                local.maxQueueSize = max(local.maxQueueSize, pq.size());
+            }
+        }
+    }
+    if (stats) *stats = local;
+}
+
+// Same, with a fresh queue of the given type
+template <typename Queue>
+void dijkstraWith(int start, const CSRGraph& graph, vector<int>& dist) {
+    Queue pq(graph);
+    dijkstraWith(start, graph, dist, pq);
+}
+
+// Queue used by plain dijkstra(), chosen at compile time:
+//   g++ -DDIJKSTRA_QUEUE=RadixHeapQueue ...   (default: the binary heap)
+//   g++ '-DDIJKSTRA_QUEUE=IndexedDaryHeap<4>' ...
+#ifndef DIJKSTRA_QUEUE
+#define DIJKSTRA_QUEUE BinaryHeapQueue
+#endif
+
+// Dijkstra's Algorithm on a weighted CSR graph
+inline void dijkstra(int start, const CSRGraph& graph, vector<int>& dist) {
+    dijkstraWith<DIJKSTRA_QUEUE>(start, graph, dist);
+}
+
+// Adjacency-list version: graph[u] contains pairs (v, weight)
+inline void dijkstra(int start, vector<vector<pii>>& graph, vector<int>& dist) {
+    dijkstra(start, buildCSR(graph), dist);
+}
+
+// Edge-list versions: contiguous {u, v, w} structs or u[] / v[] / w[] columns, read in place
+inline void dijkstra(int start, int V, ArrayView<Edge> edges, vector<int>& dist, bool directed = true) {
+    dijkstra(start, buildCSR(V, edges, directed), dist);
+}
+inline void dijkstra(int start, int V, const EdgeColumns& edges, vector<int>& dist, bool directed = true) {
+    dijkstra(start, buildCSR(V, edges, directed), dist);
+}
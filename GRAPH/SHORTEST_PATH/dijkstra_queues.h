@@ -0,0 +1,243 @@
+// 🪣 Priority queues for Dijkstra with non-negative INTEGER weights (policies for dijkstraWith in dijkstra.h)
+// Dijkstra only ever asks for the smallest tentative distance, and the popped minimum never
+// decreases (monotone). With integer keys this allows queues that are cheaper than a binary heap:
+//   BinaryHeapQueue → priority_queue<pii> with lazy deletion (the classic version), O(log n) per op
+//   RadixHeapQueue  → 33 buckets by the highest bit in which a key differs from the last popped
+//                     key; an element only moves to lower buckets → O(log C) amortized per element
+//   DialQueue       → circular array of C + 1 buckets (C = max edge weight), bucket = key mod (C + 1);
+//                     O(1) push, pop scans forward to the next non-empty bucket. Above
+//                     DIAL_MAX_BUCKETS (large weights) it falls back to a radix heap instead of
+//                     allocating C + 1 bucket vectors
+// These three use lazy deletion: an improved distance is pushed again, and the old entry is
+// recognized as stale when it is popped (its key is larger than the current dist).
+// On dense graphs that means up to E entries in the queue and many stale pops, so there is also:
+//   IndexedDaryHeap<D> → d-ary heap (D children per node, 4 by default) + pos[v] = index of v in the
+//                        heap. push() of a vertex already inside is a true DECREASE-KEY (sift up
+//                        from its slot) → at most V entries, never a stale pop. A wider node means
+//                        a shallower heap and all D children of a node sit in one or two cache lines.
+//                        The key type is a parameter too (IndexedDaryHeap<4, long long> for 64-bit distances).
+
+// 🔧 Common interface (used by dijkstraWith):
+//   explicit Q(const CSRGraph& g)   → sized for g (Dial needs the max weight)
+//   void clear()                    → empty, ready for a new query (keeps the memory)
+//   void push(int key, int v), bool empty(), size_t size(), pair<int, int> pop() → (key, v) with the smallest key
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+using namespace std;
+
+inline int maxEdgeWeight(const CSRGraph& g) {
+    int maxW = 0;
+    for (int w : g.weights) maxW = max(maxW, w);
+    return maxW;
+}
+
+class BinaryHeapQueue {
+public:
+    explicit BinaryHeapQueue(const CSRGraph&) {}
+    void clear() { heap = {}; }
+    void push(int key, int v) { heap.push({key, v}); }
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    pair<int, int> pop() {
+        pair<int, int> top = heap.top();
+        heap.pop();
+        return top;
+    }
+
+private:
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> heap;
+};
+
+class RadixHeapQueue {
+public:
+    explicit RadixHeapQueue(const CSRGraph&) { clear(); }
+
+    void clear() {
+        for (auto& b : buckets) b.clear();
+        last = 0;
+        count = 0;
+    }
+
+    // key must be ≥ the last popped key (always true in Dijkstra)
+    void push(int key, int v) {
+        buckets[bucketOf(key)].push_back({key, v});
+        count++;
+    }
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    pair<int, int> pop() {
+        if (buckets[0].empty()) {
+            // Refill bucket 0: take the first non-empty bucket, its minimum becomes the new `last`,
+            // and all of its elements fall into lower buckets (they now share more high bits with last)
+            int i = 1;
+            while (buckets[i].empty()) i++;
+            last = buckets[i][0].first;
+            for (auto& item : buckets[i]) last = min(last, item.first);
+            for (auto& item : buckets[i]) buckets[bucketOf(item.first)].push_back(item);
+            buckets[i].clear();
+        }
+        pair<int, int> top = buckets[0].back();   // Every key in bucket 0 equals last
+        buckets[0].pop_back();
+        count--;
+        return top;
+    }
+
+private:
+    // 0 if key == last, otherwise 1 + index of the highest bit where key and last differ
+    int bucketOf(int key) const {
+        unsigned diff = (unsigned)key ^ (unsigned)last;
+        return diff == 0 ? 0 : 32 - __builtin_clz(diff);
+    }
+
+    vector<pair<int, int>> buckets[33];
+    int last = 0;
+    size_t count = 0;
+};
+
+// Most buckets DialQueue allocates (24 MiB of empty vectors); larger max weights use the radix heap
+const int DIAL_MAX_BUCKETS = 1 << 20;
+
+class DialQueue {
+public:
+    // All live keys lie in [current, current + C], so C + 1 buckets never collide
+    explicit DialQueue(const CSRGraph& g) : fallback(g) {
+        int maxW = maxEdgeWeight(g);
+        useFallback = maxW >= DIAL_MAX_BUCKETS;   // Weights up to ~2^31 would mean tens of GB of buckets
+        if (!useFallback) buckets.resize(maxW + 1);
+        clear();
+    }
+
+    void clear() {
+        for (auto& b : buckets) b.clear();
+        fallback.clear();
+        current = 0;
+        count = 0;
+    }
+
+    void push(int key, int v) {
+        if (useFallback) return fallback.push(key, v);
+        buckets[key % buckets.size()].push_back(v);
+        count++;
+    }
+
+    bool empty() const { return useFallback ? fallback.empty() : count == 0; }
+    size_t size() const { return useFallback ? fallback.size() : count; }
+    bool usesFallback() const { return useFallback; }
+
+    pair<int, int> pop() {
+        if (useFallback) return fallback.pop();
+        while (buckets[current % buckets.size()].empty()) current++;
+        vector<int>& b = buckets[current % buckets.size()];
+        int v = b.back();
+        b.pop_back();
+        count--;
+        return {current, v};
+    }
+
+private:
+    vector<vector<int>> buckets;
+    int current = 0;        // Key of the bucket being emptied (never decreases)
+    size_t count = 0;
+    bool useFallback = false;
+    RadixHeapQueue fallback;   // Only used when the max weight is too large for buckets
+};
+
+template <int D = 4, typename Key = int>
+class IndexedDaryHeap {
+public:
+    explicit IndexedDaryHeap(int V = 0) : pos(V, -1) { heap.reserve(V); }
+    explicit IndexedDaryHeap(const CSRGraph& g) : IndexedDaryHeap(g.V) {}
+
+    // Empty the heap; pos is reset only for the vertices still inside (O(size), not O(V))
+    void clear() {
+        for (auto& item : heap) pos[item.second] = -1;
+        heap.clear();
+    }
+
+    // Insert v, or lower its key if it is already in the heap (Dijkstra never raises a key)
+    void push(Key key, int v) {
+        int i = pos[v];
+        if (i == -1) {
+            i = (int)heap.size();
+            heap.push_back({key, v});
+        } else {
+            heap[i].first = key;
+        }
+        siftUp(i);
+    }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    pair<Key, int> pop() {
+        pair<Key, int> top = heap[0];
+        pos[top.second] = -1;
+        pair<Key, int> lastItem = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = lastItem;
+            pos[lastItem.second] = 0;
+            siftDown(0);
+        }
+        return top;
+    }
+
+private:
+    // Move the item at i up while its parent is larger (the hole moves, the item is written once)
+    void siftUp(int i) {
+        pair<Key, int> item = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (heap[parent].first <= item.first) break;
+            heap[i] = heap[parent];
+            pos[heap[i].second] = i;
+            i = parent;
+        }
+        heap[i] = item;
+        pos[item.second] = i;
+    }
+
+    // Move the item at i down to the smallest of its D children while that child is smaller
+    void siftDown(int i) {
+        pair<Key, int> item = heap[i];
+        int n = (int)heap.size();
+        while (true) {
+            int first = i * D + 1;
+            if (first >= n) break;
+            int best = first;
+            int last = min(first + D, n);
+            for (int c = first + 1; c < last; c++) {
+                if (heap[c].first < heap[best].first) best = c;
+            }
+            if (heap[best].first >= item.first) break;
+            heap[i] = heap[best];
+            pos[heap[i].second] = i;
+            i = best;
+        }
+        heap[i] = item;
+        pos[item.second] = i;
+    }
+
+    vector<pair<Key, int>> heap;   // (key, vertex), heap[0] = minimum, children of i: i*D+1 .. i*D+D
+    vector<int> pos;               // pos[v] = index of v in heap, -1 if not inside
+};
+
+
+// ⏱ Time Complexity (TC) of one Dijkstra run (n pushes, C = max edge weight):
+// BinaryHeapQueue → O((V + E) log V)
+// RadixHeapQueue  → O(E + V log C): each element moves down at most 32 buckets
+// DialQueue       → O(E + V + max distance): pop walks over the key range once
+// IndexedDaryHeap → O(V D log_D V + E log_D V): pops sift down (D compares per level),
+//                   decrease-keys sift up (1 compare per level)
+
+// 🧠 Space Complexity (SC):
+// Lazy queues: one entry per push (stale ones included); Dial adds C + 1 bucket headers
+// IndexedDaryHeap: at most V entries + the V-int position array
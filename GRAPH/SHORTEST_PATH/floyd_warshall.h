@@ -0,0 +1,31 @@
+// 📚 Floyd-Warshall core loop (explained in 3-Floyd-Warshall.cpp).
+// Kept in a header so other programs (benchmarks) call the very same code.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+// Turns the adjacency matrix `dist` (inf = no edge) into all-pairs shortest distances, in place.
+// Returns false if the graph contains a negative weight cycle.
+inline bool floydWarshallDistances(vector<vector<int>>& dist, int inf) {
+    int n = dist.size();
+
+    for (int k = 0; k < n; k++) {         // Intermediate vertex
+        for (int i = 0; i < n; i++) {     // Source vertex
+            if (dist[i][k] >= inf) continue;
+            for (int j = 0; j < n; j++) { // Destination vertex
+                // If a shorter path exists through vertex k, update it
+                if (dist[k][j] < inf)
+                    dist[i][j] = min(dist[i][j], dist[i][k] + dist[k][j]);
+            }
+        }
+    }
+
+    // A negative distance from a vertex to itself means a negative weight cycle
+    for (int i = 0; i < n; i++) {
+        if (dist[i][i] < 0) return false;
+    }
+    return true;
+}
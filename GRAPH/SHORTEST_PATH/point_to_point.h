@@ -0,0 +1,247 @@
+// 📍 Point-to-point shortest paths: one source s, one target t (explained in 6-Point-To-Point.cpp)
+// dijkstra() settles the whole graph. For a single target that is wasted work, so:
+//   shortestPath              → Dijkstra that stops as soon as t is settled (early exit)
+//   shortestPathBidirectional → one search forward from s, one backward from t (on the reverse
+//                               graph); each only has to cover a "radius" of about half the distance
+//   shortestPathAStar         → Dijkstra ordered by dist(s, v) + h(v), where h(v) ≤ dist(v, t)
+//                               (admissible) pulls the search towards t
+//   ALTLandmarks              → a heuristic for A*: exact distances from / to a few landmark
+//                               vertices + the triangle inequality give lower bounds on dist(v, t)
+// All of them return the distance, the path s → ... → t and how many vertices were settled.
+// Each mode can run in caller-owned SSSPWorkspace objects (sssp_workspace.h): reset is O(1) and
+// distances are 64-bit, so a query costs what it settles, not O(V). Without one, a temporary is used.
+
+#pragma once
+
+#include <vector>
+#include <climits>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "sssp_workspace.h"   // SSSPWorkspace, dijkstraLocal (landmark preprocessing)
+using namespace std;
+
+struct PathResult {
+    long long dist = LLONG_MAX;   // LLONG_MAX if t cannot be reached
+    vector<int> path;             // s, ..., t (empty if unreachable)
+    long long settled = 0;        // Vertices taken out of the queue (both directions together)
+};
+
+// Check a result against g: the path must start at s, end at t, use existing edges and add up to
+// the reported distance (an unreachable t must come with an empty path)
+inline bool validPath(const CSRGraph& g, int s, int t, const PathResult& r) {
+    if (r.dist == LLONG_MAX) return r.path.empty();
+    if (r.path.empty() || r.path.front() != s || r.path.back() != t) return false;
+    long long total = 0;
+    for (size_t i = 0; i + 1 < r.path.size(); i++) {
+        int best = INT_MAX;
+        for (int k = g.offsets[r.path[i]]; k < g.offsets[r.path[i] + 1]; k++) {
+            if (g.adj[k] == r.path[i + 1]) best = min(best, g.isWeighted() ? g.weights[k] : 1);
+        }
+        if (best == INT_MAX) return false;
+        total += best;
+    }
+    return total == r.dist;
+}
+
+// No heuristic: A* with h = 0 is plain Dijkstra
+struct ZeroHeuristic {
+    int operator()(int) const { return 0; }
+};
+
+// Walk parent links back from `to` (the source has parent -1)
+template <typename Dist>
+void appendPathTo(const SSSPWorkspace<Dist>& ws, int to, vector<int>& path) {
+    size_t begin = path.size();
+    for (int v = to; v != -1; v = ws.parent(v)) path.push_back(v);
+    reverse(path.begin() + begin, path.end());
+}
+
+// A*: settle vertices in order of dist(s, v) + h(v); stop when t is settled.
+// With a consistent heuristic (h(u) ≤ w(u, v) + h(v), true for ALT and for 0) a settled vertex is
+// never improved again and the first time t comes out its distance is final.
+template <typename Heuristic, typename Dist>
+PathResult shortestPathAStar(const CSRGraph& g, int s, int t, Heuristic h, SSSPWorkspace<Dist>& ws) {
+    PathResult res;
+    ws.prepare(g.V);
+    auto& pq = ws.heap();
+    ws.label(s, 0, -1);
+    pq.push(h(s), s);
+    while (!pq.empty()) {
+        int u = pq.pop().second;
+        res.settled++;
+        ws.settle(u);
+        if (u == t) break;   // Early exit
+
+        Dist du = ws.dist(u);
+        for (int i = g.offsets[u]; i < g.offsets[u + 1]; i++) {
+            int v = g.adj[i];
+            Dist nd = du + g.weights[i];
+            if (nd < ws.dist(v)) {
+                ws.label(v, nd, u);
+                pq.push(nd + h(v), v);
+            }
+        }
+    }
+
+    if (ws.reached(t)) {
+        res.dist = ws.dist(t);
+        appendPathTo(ws, t, res.path);
+    }
+    return res;
+}
+
+template <typename Heuristic>
+PathResult shortestPathAStar(const CSRGraph& g, int s, int t, Heuristic h) {
+    SSSPWorkspace<> ws(g.V);
+    return shortestPathAStar(g, s, t, h, ws);
+}
+
+// Dijkstra from s that stops as soon as t is settled
+template <typename Dist>
+PathResult shortestPath(const CSRGraph& g, int s, int t, SSSPWorkspace<Dist>& ws) {
+    return shortestPathAStar(g, s, t, ZeroHeuristic(), ws);
+}
+
+inline PathResult shortestPath(const CSRGraph& g, int s, int t) {
+    return shortestPathAStar(g, s, t, ZeroHeuristic());
+}
+
+// Bidirectional Dijkstra. reverse = transposeCSR(g) (built once, shared by all queries).
+// Both searches take turns (the side with the smaller queue goes next). Every edge that
+// reaches a vertex already labeled by the other side gives a candidate s → t path; the search
+// stops when the two queue minimums together can no longer beat the best candidate.
+template <typename Dist>
+PathResult shortestPathBidirectional(const CSRGraph& g, const CSRGraph& reverse, int s, int t,
+                                     SSSPWorkspace<Dist>& forward, SSSPWorkspace<Dist>& backward) {
+    PathResult res;
+    if (s == t) {
+        res.dist = 0;
+        res.path = {s};
+        return res;
+    }
+
+    const CSRGraph* graph[2] = {&g, &reverse};
+    SSSPWorkspace<Dist>* ws[2] = {&forward, &backward};
+    Dist topKey[2] = {0, 0};   // Key of the last settled vertex per side (a lower bound for the rest)
+    forward.prepare(g.V);
+    backward.prepare(g.V);
+    forward.label(s, 0, -1);
+    backward.label(t, 0, -1);
+    forward.heap().push(0, s);
+    backward.heap().push(0, t);
+    Dist best = SSSPWorkspace<Dist>::INF;
+    int meet = -1;
+
+    while (!forward.heap().empty() && !backward.heap().empty()) {
+        int side = forward.heap().size() <= backward.heap().size() ? 0 : 1;   // Expand the smaller frontier
+        SSSPWorkspace<Dist>& me = *ws[side];
+        SSSPWorkspace<Dist>& other = *ws[1 - side];
+        pair<Dist, int> top = me.heap().pop();
+        int u = top.second;
+        topKey[side] = top.first;
+        res.settled++;
+        me.settle(u);
+        if (meet != -1 && topKey[0] + topKey[1] >= best) break;
+
+        const CSRGraph& gr = *graph[side];
+        for (int i = gr.offsets[u]; i < gr.offsets[u + 1]; i++) {
+            int v = gr.adj[i];
+            Dist nd = top.first + gr.weights[i];
+            if (nd < me.dist(v)) {
+                me.label(v, nd, u);
+                me.heap().push(nd, v);
+            }
+            if (other.reached(v) && me.dist(v) + other.dist(v) < best) {
+                best = me.dist(v) + other.dist(v);   // v is labeled from both sides
+                meet = v;
+            }
+        }
+    }
+
+    if (meet != -1) {
+        res.dist = best;   // == forward.dist(meet) + backward.dist(meet)
+        appendPathTo(forward, meet, res.path);
+        for (int v = backward.parent(meet); v != -1; v = backward.parent(v)) res.path.push_back(v);
+    }
+    return res;
+}
+
+inline PathResult shortestPathBidirectional(const CSRGraph& g, const CSRGraph& reverse, int s, int t) {
+    SSSPWorkspace<> forward(g.V), backward(g.V);
+    return shortestPathBidirectional(g, reverse, s, t, forward, backward);
+}
+
+// ALT (A*, Landmarks, Triangle inequality) lower bounds
+// For a landmark L: dist(v, t) ≥ dist(L, t) - dist(L, v)   and   dist(v, t) ≥ dist(v, L) - dist(t, L)
+// Landmarks are picked "farthest first": each new one is the vertex farthest from those chosen so far,
+// so they end up on the border of the graph, where the bounds are tightest.
+class ALTLandmarks {
+public:
+    typedef SSSPWorkspace<>::DistType Dist;   // 64-bit, like the searches the bounds guide
+    static constexpr Dist INF = SSSPWorkspace<>::INF;
+
+    // Run 2 SSSPs per landmark (forward on g, backward on reverse) → numLandmarks * 2 * V distances
+    void build(const CSRGraph& g, const CSRGraph& reverse, int numLandmarks, int firstLandmark = 0) {
+        V = g.V;
+        L = numLandmarks;
+        from.assign((size_t)V * L, INF);
+        to.assign((size_t)V * L, INF);
+        landmarks.clear();
+
+        SSSPWorkspace<> ws(V);
+        vector<Dist> closest(V, INF);   // closest[v] = distance to the nearest chosen landmark
+        int next = firstLandmark;
+        for (int l = 0; l < L; l++) {
+            landmarks.push_back(next);
+            dijkstraLocal(next, g, ws);
+            for (int v = 0; v < V; v++) {
+                from[(size_t)v * L + l] = ws.dist(v);
+                closest[v] = min(closest[v], ws.dist(v));
+            }
+            dijkstraLocal(next, reverse, ws);
+            for (int v = 0; v < V; v++) to[(size_t)v * L + l] = ws.dist(v);
+
+            // Farthest reachable vertex from all landmarks so far
+            next = landmarks[0];
+            for (int v = 0; v < V; v++) {
+                if (closest[v] != INF && closest[v] > closest[next]) next = v;
+            }
+        }
+    }
+
+    // Lower bound on dist(v, t); terms with an unreachable landmark are skipped
+    Dist lowerBound(int v, int t) const {
+        const Dist* fv = from.data() + (size_t)v * L;
+        const Dist* ft = from.data() + (size_t)t * L;
+        const Dist* tv = to.data() + (size_t)v * L;
+        const Dist* tt = to.data() + (size_t)t * L;
+        Dist bound = 0;
+        for (int l = 0; l < L; l++) {
+            if (ft[l] != INF && fv[l] != INF) bound = max(bound, ft[l] - fv[l]);
+            if (tv[l] != INF && tt[l] != INF) bound = max(bound, tv[l] - tt[l]);
+        }
+        return bound;
+    }
+
+    // Heuristic object for shortestPathAStar towards target t
+    struct Heuristic {
+        const ALTLandmarks* alt;
+        int t;
+        Dist operator()(int v) const { return alt->lowerBound(v, t); }
+    };
+    Heuristic towards(int t) const { return {this, t}; }
+
+    const vector<int>& chosen() const { return landmarks; }
+
+private:
+    int V = 0, L = 0;
+    vector<int> landmarks;
+    vector<Dist> from, to;   // from[v * L + l] = dist(landmark l, v), to[v * L + l] = dist(v, landmark l)
+};
+
+// ⏱ Time Complexity (TC):
+// Every mode is Dijkstra on the part of the graph it settles: O((V' + E') log V'), V' = settled
+// (whole graph in the worst case). ALT preprocessing → 2 * numLandmarks full SSSPs.
+
+// 🧠 Space Complexity (SC):
+// O(V) per workspace, allocated once and reused across queries; ALT → 2 * numLandmarks * V 64-bit distances
@@ -0,0 +1,56 @@
+// 📈 Shared harness for the Dijkstra queue comparisons (4-Integer-Priority-Queues.cpp,
+// 5-Indexed-Dary-Heap.cpp): the same queries with one queue policy, one queue reused by all of them.
+// Only dijkstraWith itself is timed; checking the distances against the reference runs after the
+// clock stops, so the O(V) comparison is not part of the reported time.
+
+#pragma once
+
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "../CORE/perf_counter.h"
+#include "dijkstra.h"   // dijkstraWith, DijkstraStats
+using namespace std;
+
+struct QueueRunResult {
+    double msPerQuery = 0;
+    DijkstraStats total;          // pushes / stalePops summed over the queries, maxQueueSize = max
+    long long cacheMisses = -1;   // LLC misses summed over the queries, -1 if not counted
+    bool same = true;             // Every query matched expected (skipped if expected is empty)
+};
+
+// counter (optional) counts cache misses around each query
+template <typename Queue>
+QueueRunResult runQueueQueries(const CSRGraph& g, const vector<int>& sources,
+                               const vector<vector<int>>& expected, CacheMissCounter* counter = nullptr) {
+    Queue pq(g);   // Built once, reused by every query
+    vector<int> dist;
+    DijkstraStats stats;
+    QueueRunResult res;
+    double ms = 0;
+    if (counter && counter->available()) res.cacheMisses = 0;
+
+    for (size_t i = 0; i < sources.size(); i++) {
+        if (counter) counter->start();
+        auto start = chrono::steady_clock::now();
+        dijkstraWith(sources[i], g, dist, pq, &stats);
+        ms += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (counter) {
+            long long misses = counter->stop();
+            if (res.cacheMisses >= 0) res.cacheMisses += misses;
+        }
+
+        res.total.pushes += stats.pushes;
+        res.total.stalePops += stats.stalePops;
+        res.total.maxQueueSize = max(res.total.maxQueueSize, stats.maxQueueSize);
+        res.same = res.same && (expected.empty() || dist == expected[i]);
+    }
+    res.msPerQuery = ms / max<size_t>(1, sources.size());
+    return res;
+}
+
+
+// ⏱ Time Complexity (TC): one dijkstraWith per source + O(V) check per source (untimed)
+
+// 🧠 Space Complexity (SC): one queue + one distance array, reused by all queries
@@ -0,0 +1,126 @@
+// ♻️ Reusable SSSP workspace: distances, parents and the heap survive from one query to the next
+// (explained and benchmarked in 9-SSSP-Workspace.cpp)
+// dijkstra() starts every call with dist.assign(V, INT_MAX): O(V) even when the query only touches
+// a few hundred vertices around the source. The workspace instead keeps a generation number:
+//   stamp[v] == gen → dist[v] / parent[v] belong to the current query
+//   anything else   → v has not been reached yet (distance = INF)
+// Starting a new query is ++gen, O(1); only when the counter wraps around is stamp[] cleared once.
+// The heap (IndexedDaryHeap) is emptied in O(entries left), and touched() / settled() list the
+// vertices the query labeled / finished, so results can be read without scanning all V vertices.
+// ⚠️ A query that stops early (target reached, radius exceeded) leaves labeled-but-unsettled
+// vertices behind: their dist() is only an upper bound. Final distances are those of settled().
+// Dist is a template parameter, 64-bit by default: dist[u] + w cannot overflow on long paths
+// (an int overflows after 2^31 - 1, e.g. 3 edges of weight 10^9).
+
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "dijkstra_queues.h"   // IndexedDaryHeap
+using namespace std;
+
+template <typename Dist = long long>
+class SSSPWorkspace {
+public:
+    typedef Dist DistType;
+    static constexpr Dist INF = numeric_limits<Dist>::max();
+
+    explicit SSSPWorkspace(int V = 0) { prepare(V); }
+
+    // Start a new query on a graph with V vertices: O(1) unless the workspace has to grow
+    void prepare(int V) {
+        if ((int)stamp.size() < V) {
+            distance.resize(V);
+            parents.resize(V);
+            stamp.assign(V, 0);
+            gen = 0;
+            queue = IndexedDaryHeap<4, Dist>(V);
+        }
+        if (++gen == 0) {                 // Generation counter wrapped around → clear once
+            fill(stamp.begin(), stamp.end(), 0);
+            gen = 1;
+        }
+        queue.clear();
+        labeled.clear();
+        finished.clear();
+    }
+
+    Dist dist(int v) const { return stamp[v] == gen ? distance[v] : INF; }
+    int parent(int v) const { return stamp[v] == gen ? parents[v] : -1; }
+    bool reached(int v) const { return stamp[v] == gen; }
+
+    // Set v's label for the current query (first label also records v in touched())
+    void label(int v, Dist d, int p) {
+        if (stamp[v] != gen) {
+            stamp[v] = gen;
+            labeled.push_back(v);
+        }
+        distance[v] = d;
+        parents[v] = p;
+    }
+
+    // v left the queue with its final distance
+    void settle(int v) { finished.push_back(v); }
+
+    IndexedDaryHeap<4, Dist>& heap() { return queue; }
+    const vector<int>& touched() const { return labeled; }    // Labeled in the current query (tentative)
+    const vector<int>& settled() const { return finished; }   // Settled, in order of distance (final)
+
+    size_t memoryBytes() const {
+        return distance.size() * sizeof(Dist) + parents.size() * sizeof(int) + stamp.size() * sizeof(unsigned);
+    }
+
+private:
+    vector<Dist> distance;
+    vector<int> parents;
+    vector<unsigned> stamp;
+    unsigned gen = 0;
+    IndexedDaryHeap<4, Dist> queue;
+    vector<int> labeled;
+    vector<int> finished;
+};
+
+// Dijkstra from start into ws. Stops early once `target` is settled (if given) or when the next
+// distance exceeds maxDist, so the cost is proportional to the part of the graph it explores.
+// Returns the number of settled vertices. ws.settled() lists them (exactly the vertices with
+// distance ≤ maxDist, target included); only their ws.dist / ws.parent are final. Other vertices
+// in ws.touched() were labeled but not settled and hold tentative distances.
+template <typename Dist>
+long long dijkstraLocal(int start, const CSRGraph& graph, SSSPWorkspace<Dist>& ws,
+                        int target = -1, Dist maxDist = SSSPWorkspace<Dist>::INF) {
+    ws.prepare(graph.V);
+    auto& pq = ws.heap();
+    ws.label(start, 0, -1);
+    pq.push(0, start);
+
+    long long settled = 0;
+    while (!pq.empty()) {
+        pair<Dist, int> top = pq.pop();   // Indexed heap: never a stale entry
+        Dist d = top.first;
+        int u = top.second;
+        if (d > maxDist) break;
+        settled++;
+        ws.settle(u);
+        if (u == target) break;
+
+        for (int i = graph.offsets[u]; i < graph.offsets[u + 1]; i++) {
+            int v = graph.adj[i];
+            Dist nd = d + graph.weights[i];
+            if (nd < ws.dist(v)) {
+                ws.label(v, nd, u);
+                pq.push(nd, v);
+            }
+        }
+    }
+    return settled;
+}
+
+
+// ⏱ Time Complexity (TC), one query:
+// O(1) reset + O((V' + E') log V'), V' / E' = vertices / edges the search reaches
+// (dijkstra() with dist.assign: O(V) on top of that, every time)
+
+// 🧠 Space Complexity (SC):
+// O(V) once per workspace (Dist + parent + stamp per vertex, V-slot position array in the heap)
@@ -0,0 +1,182 @@
+// 🗜️ Compressed adjacency for graphs that do not fit in RAM as plain int arrays
+// CSR stores every neighbor as a 4-byte int. CORE/compressed_graph.h sorts every neighbor list,
+// stores the gaps between neighbors with 1-4 bytes each (group varint, StreamVByte-style) and
+// decodes them while the traversal iterates. BFS, DFS, Kahn's topological sort and all cycle
+// detectors run on it unchanged, because they only use V and neighbors(u).
+
+// 🧠 What this program shows
+// 1. The small graph from 1-BFS.cpp, compressed, gives the same BFS.
+// 2. Bytes per edge: CSR vs compressed, for a power-law graph and a grid, with random ids and
+//    after BFS reordering (CORE/reorder.h): nearby ids → small gaps → fewer bytes.
+// 3. The same compressed graph built by streaming a text edge list / a .csr file.
+// 4. Traversal slowdown: each algorithm on CSR (neighbors sorted the same way) vs compressed.
+
+// 🔧 Usage: ./a.out [rmat scale = 18] [grid side = 1000]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/generators.h"
+#include "../CORE/reorder.h"
+#include "../CORE/dfs_engine.h"
+#include "../CORE/compressed_graph.h"
+#include "../BFS_DFS/bfs.h"
+#include "../TOPOLOGICAL SORT/kahn.h"
+#include "../TOPOLOGICAL SORT/cycle_bfs.h"
+using namespace std;
+
+// Best of 3 runs, in milliseconds
+template <typename Run>
+double timeMs(Run run) {
+    double best = 1e18;
+    for (int i = 0; i < 3; i++) {
+        auto start = chrono::steady_clock::now();
+        run();
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+// CSR with every neighbor list sorted (the compressed graph also iterates in sorted order,
+// so both layouts give identical traversals)
+CSRGraph sortedCSR(const CSRGraph& g) {
+    vector<int> identity(g.V);
+    for (int v = 0; v < g.V; v++) identity[v] = v;
+    return relabel(g, reorderingFromOrder(identity));
+}
+
+void printSize(const string& name, const CSRGraph& g) {
+    CompressedGraph cg = compressGraph(g);
+    cout << left << setw(34) << name << fixed << setprecision(2)
+         << setw(12) << csrBytesPerEdge(g) << setw(14) << cg.bytesPerEdge()
+         << setprecision(1) << csrBytesPerEdge(g) / cg.bytesPerEdge() << "x" << endl;
+}
+
+// One row: algorithm on the CSR graph vs on the compressed graph
+template <typename Run>
+void compareRow(const string& name, const CSRGraph& g, const CompressedGraph& cg, Run run) {
+    auto expected = run(g);
+    auto got = run(cg);
+    double csrMs = timeMs([&] { run(g); });
+    double cgMs = timeMs([&] { run(cg); });
+    cout << left << setw(26) << name << fixed << setprecision(2)
+         << setw(12) << csrMs << setw(14) << cgMs << setw(10) << cgMs / csrMs
+         << (expected == got ? "yes" : "NO") << endl;
+}
+
+void compareTraversals(const string& title, const CSRGraph& und, const CSRGraph& dag) {
+    CompressedGraph cund = compressGraph(und), cdag = compressGraph(dag);
+    int src = 0;
+    for (int v = 1; v < und.V; v++) {
+        if (und.degree(v) > und.degree(src)) src = v;
+    }
+
+    cout << endl << title << " (V = " << und.V << ", undirected E = " << und.numEdges()
+         << ", DAG E = " << dag.numEdges() << ")" << endl;
+    cout << left << setw(26) << "Algorithm" << setw(12) << "CSR (ms)" << setw(14) << "Compressed"
+         << setw(10) << "Slowdown" << "Same result" << endl;
+
+    compareRow("bfsOfGraph", und, cund, [&](const auto& g) { return bfsOfGraph(g, src); });
+    compareRow("dfsOrder", und, cund, [&](const auto& g) { return dfsOrder(g, src); });
+    compareRow("dfsTopoSort (DAG)", dag, cdag, [](const auto& g) { return dfsTopoSort(g); });
+    compareRow("kahnTopoSort (DAG)", dag, cdag, [](const auto& g) { return kahnTopoSort(g); });
+    compareRow("hasDirectedCycle (DAG)", dag, cdag, [](const auto& g) { return hasDirectedCycle(g); });
+    compareRow("hasCycleKahn (DAG)", dag, cdag, [](const auto& g) { return hasCycleKahn(g); });
+    compareRow("hasUndirectedCycleBFS", und, cund, [](const auto& g) { return hasUndirectedCycleBFS(g); });
+    compareRow("hasUndirectedCycle", und, cund, [](const auto& g) { return hasUndirectedCycle(g); });
+}
+
+// Orient every edge from the smaller to the larger id → a DAG
+vector<Edge> orientAcyclic(vector<Edge> edges) {
+    vector<Edge> dag;
+    for (auto e : edges) {
+        if (e.u == e.v) continue;
+        if (e.u > e.v) swap(e.u, e.v);
+        dag.push_back(e);
+    }
+    return dag;
+}
+
+int main(int argc, char** argv) {
+    // Small example (same graph as 1-BFS.cpp)
+    vector<vector<int>> adj = {{1, 2}, {0, 3}, {0, 4}, {1}, {2}};
+    CSRGraph small = buildCSR(adj);
+    CompressedGraph csmall = compressGraph(small);
+    cout << "BFS Traversal (compressed): ";
+    for (int node : bfsOfGraph(csmall)) cout << node << " ";
+    cout << endl;
+    cout << "CSR bytes: " << (small.offsets.size() + small.adj.size()) * sizeof(int)
+         << ", compressed list bytes: " << csmall.bytes.size() << " (+ " << csmall.indexBytes()
+         << " bytes of offsets)" << endl;
+
+    int scale = argc > 1 ? atoi(argv[1]) : 18;
+    int side = argc > 2 ? atoi(argv[2]) : 1000;
+
+    vector<Edge> rmat = rmatEdges(scale, 16);
+    vector<Edge> grid = gridEdges(side, side);
+    shuffleLabels(side * side, grid, 2);   // Ids as they would come from an external system
+
+    CSRGraph rmatUnd = sortedCSR(buildCSR(1 << scale, rmat, false, false));
+    CSRGraph gridUnd = sortedCSR(buildCSR(side * side, grid, false, false));
+
+    // 📦 Memory
+    cout << endl << left << setw(34) << "Graph" << setw(12) << "CSR B/edge" << setw(14) << "Compressed"
+         << "Ratio" << endl;
+    printSize("RMAT scale " + to_string(scale) + ", random ids", rmatUnd);
+    printSize("RMAT, BFS-reordered", relabel(rmatUnd, bfsReorder(rmatUnd)));
+    printSize("Grid " + to_string(side) + "x" + to_string(side) + ", random ids", gridUnd);
+    printSize("Grid, BFS-reordered", relabel(gridUnd, bfsReorder(gridUnd)));
+
+    // 📥 Streaming builds: the same grid straight from a text edge list (several passes with a
+    // small buffer) and from a .csr file, never holding the edge list itself in memory
+    string textPath = "/tmp/compressed_demo_edges.txt", csrPath = "/tmp/compressed_demo.csr";
+    FILE* out = fopen(textPath.c_str(), "w");
+    if (!out) {
+        cout << "Cannot write " << textPath << endl;
+        return 1;
+    }
+    for (const Edge& e : grid) fprintf(out, "%d %d\n", e.u, e.v);
+    fclose(out);
+
+    CompressedGraph fromCSR = compressGraph(gridUnd), fromText, fromFile;
+    string error;
+    size_t buffered = grid.size() / 2;   // 2 * E ids in total → about 4 range passes
+    bool textOk = compressEdgeFile(textPath, false, fromText, error, buffered);
+    if (!textOk) cout << error << endl;
+    bool fileOk = writeGraphFile(csrPath, gridUnd, false, error) && compressGraphFile(csrPath, fromFile, error);
+    if (!fileOk) cout << error << endl;
+    remove(textPath.c_str());
+    remove(csrPath.c_str());
+    cout << endl << "Streaming builds of the grid (" << buffered << " ids buffered per pass): "
+         << "edge list " << (textOk && fromText.bytes == fromCSR.bytes ? "same" : "DIFFERENT")
+         << ", .csr file " << (fileOk && fromFile.bytes == fromCSR.bytes ? "same" : "DIFFERENT") << endl;
+
+    // ⏱ Speed
+    compareTraversals("RMAT scale " + to_string(scale), rmatUnd,
+                      sortedCSR(buildCSR(1 << scale, orientAcyclic(rmat), true, false)));
+    Reordering r = bfsReorder(gridUnd);
+    for (auto& e : grid) {
+        e.u = r.newId[e.u];
+        e.v = r.newId[e.v];
+    }
+    compareTraversals("Grid " + to_string(side) + "x" + to_string(side) + ", BFS-reordered",
+                      sortedCSR(buildCSR(side * side, grid, false, false)),
+                      sortedCSR(buildCSR(side * side, orientAcyclic(grid), true, false)));
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Every traversal keeps its O(V + E); decoding adds a small constant per neighbor (table lookup,
+// 4-byte load, mask, add), paid back on graphs whose CSR arrays would not fit in memory / cache.
+
+// 🧠 Space Complexity (SC):
+// Compressed graph → about 2.2 bytes per vertex of offsets + about 1-2 bytes per edge (sorted lists with local ids)
+// compressEdgeFile → degrees + one buffer of maxBufferedEdges ids on top of the output
+// CSR → 4 * (V + 1 + E)
@@ -0,0 +1,159 @@
+// 📏 Compact edge-list input
+// The classic signature topoSort(int V, vector<vector<int>>& edges) stores every edge as its own
+// little vector: one heap allocation per edge (~32 bytes of heap block + a 24-byte vector header
+// for 8 bytes of data). With 100M edges that is ~5.6 GB and 100M calls to malloc before any
+// algorithm has even started.
+
+// 🧠 Contiguous alternatives (CORE/csr_graph.h), accepted by buildCSR and by the edge-list
+// versions of bfsOfGraph / dfsOfGraph / dijkstra / topoSort / hasCycle / isCycle / bellmanFord /
+// firstCycleEdge / GraphBatch::add:
+//   vector<EdgeUV> / vector<Edge>  → array of structs {u, v} / {u, v, w}: 8 / 12 bytes per edge
+//   EdgeColumns                    → struct of arrays: separate u[], v[] (and w[]) columns
+//   ArrayView<T>                   → (pointer, size) view over any of those, nothing is copied
+// 📥 EdgeListReader (CORE/graph_file.h) parses a text file in fixed-size chunks into a caller-owned
+// EdgeUV / Edge array, and buildCSRFromEdgeFile uses it to build a CSR graph in two streaming
+// passes without ever holding the edge list in memory.
+
+// 🔧 Usage: ./a.out [log2 of the edge count = 23]
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/graph_file.h"
+#include "../TOPOLOGICAL SORT/kahn.h"
+#include "../BFS_DFS/bfs.h"
+using namespace std;
+
+// Peak RSS of the current phase: reset the high-water mark (Linux), then read VmHWM
+void resetPeakRss() {
+    ofstream clear("/proc/self/clear_refs");
+    if (clear) clear << "5";
+}
+
+double peakRssMB() {
+    ifstream status("/proc/self/status");
+    string key;
+    while (status >> key) {
+        if (key == "VmHWM:") {
+            long long kb;
+            status >> kb;
+            return kb / 1024.0;
+        }
+        status.ignore(1 << 20, '\n');
+    }
+    return -1;
+}
+
+// Same pseudo-random edge i for every representation (no shared source array in memory)
+inline EdgeUV edgeAt(long long i, int V) {
+    uint64_t x = (uint64_t)i * 0x9E3779B97F4A7C15ULL;
+    x ^= x >> 29;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 32;
+    return {(int)(x % V), (int)((x >> 32) % V)};
+}
+
+template <typename Run>
+void measure(const string& name, Run run) {
+    resetPeakRss();
+    auto start = chrono::steady_clock::now();
+    uint64_t checksum = run();
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << name << ms << " ms, peak RSS " << peakRssMB() << " MB, graph checksum " << checksum << endl;
+}
+
+int main(int argc, char** argv) {
+    // Small example: one DAG given in three layouts → the same CSR graph, the same order
+    vector<vector<int>> nested = {{5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}};
+    vector<EdgeUV> flat = {{5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}};
+    vector<int> us = {5, 5, 4, 4, 2, 3}, vs = {2, 0, 0, 1, 3, 1};
+
+    for (const CSRGraph& g : {buildCSR(6, nested), buildCSR(6, flat), buildCSR(6, EdgeColumns{us, vs, {}})}) {
+        cout << "Topological Sort: ";
+        for (int v : kahnTopoSort(g)) cout << v << " ";
+        cout << endl;
+    }
+
+    // The traversals take the compact layouts directly too
+    EdgeColumns cols{us, vs, {}};
+    cout << "BFS from 0 (EdgeUV, columns, undirected): "
+         << (bfsOfGraph(6, flat, false) == bfsOfGraph(6, cols, false) ? "same" : "DIFFERENT") << endl;
+
+    // 📈 Large input: nested vectors vs flat structs vs columns (input + CSR build)
+    int logE = argc > 1 ? atoi(argv[1]) : 23;
+    long long E = 1LL << logE;
+    int V = (int)(E / 8);
+    cout << endl << "V = " << V << ", E = " << E << endl;
+
+    measure("vector<vector<int>>: ", [&] {
+        vector<vector<int>> edges;
+        edges.reserve(E);
+        for (long long i = 0; i < E; i++) {
+            EdgeUV e = edgeAt(i, V);
+            edges.push_back({e.u, e.v});
+        }
+        return graphChecksum(buildCSR(V, edges));
+    });
+    measure("vector<EdgeUV>:      ", [&] {
+        vector<EdgeUV> edges(E);
+        for (long long i = 0; i < E; i++) edges[i] = edgeAt(i, V);
+        return graphChecksum(buildCSR(V, edges));
+    });
+    measure("EdgeColumns (SoA):   ", [&] {
+        vector<int> u(E), v(E);
+        for (long long i = 0; i < E; i++) {
+            EdgeUV e = edgeAt(i, V);
+            u[i] = e.u;
+            v[i] = e.v;
+        }
+        return graphChecksum(buildCSR(V, EdgeColumns{u, v, {}}));
+    });
+
+    // 📥 Text file: load the whole edge list first vs stream it in chunks
+    string path = "/tmp/compact_edges_demo.txt";
+    {
+        FILE* out = fopen(path.c_str(), "w");
+        if (!out) {
+            cout << "Cannot write " << path << endl;
+            return 1;
+        }
+        fprintf(out, "# u v\n");
+        for (long long i = 0; i < E; i++) {
+            EdgeUV e = edgeAt(i, V);
+            fprintf(out, "%d %d\n", e.u, e.v);
+        }
+        fclose(out);
+    }
+    cout << endl << "Text edge list: " << path << endl;
+
+    measure("readEdgeListText + buildCSR: ", [&] {
+        int fileV;
+        vector<Edge> edges;
+        string error;
+        if (!readEdgeListText(path, false, fileV, edges, error)) cout << error << endl;
+        return graphChecksum(buildCSR(fileV, edges, true, false));
+    });
+    measure("buildCSRFromEdgeFile:        ", [&] {
+        CSRGraph g;
+        string error;
+        if (!buildCSRFromEdgeFile(path, true, false, g, error)) cout << error << endl;
+        return graphChecksum(g);
+    });
+    remove(path.c_str());
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Every layout → O(V + E) to build the CSR graph; nested vectors add E allocations on top
+// Streaming build → two O(E) parsing passes over the file
+
+// 🧠 Space Complexity (SC):
+// vector<vector<int>> → ~56 bytes per edge, vector<EdgeUV> / EdgeColumns → 8 bytes per edge
+// Streaming build → only the CSR arrays + one fixed-size chunk
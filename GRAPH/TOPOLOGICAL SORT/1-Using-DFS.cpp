@@ -10,11 +10,12 @@
 // May not be unique (can be multiple valid topological orders)
 
 // 🧠 Algorithms to Perform Topological Sort
-// 1. DFS-Based Approach (using recursion and a stack)
+// 1. DFS-Based Approach (using DFS finishing order)
 // Logic:
 // Start DFS from each unvisited node.
 // After visiting all descendants, push the node onto a stack.
 // When all nodes are processed, pop from stack to get topological order.
+// (Here the stack is replaced by filling the answer array from the back.)
 
 
 // Topological sort is used when you need to process tasks in a specific order, based on dependencies. It applies only to Directed Acyclic Graphs (DAGs).
@@ -22,51 +23,51 @@
 
 
 #include <bits/stdc++.h>
+#include "../CORE/csr_graph.h"
+#include "../CORE/dfs_engine.h"
+#include "../CORE/generators.h"
 using namespace std;
 
-// Global adjacency list to represent the graph
-unordered_map<int, vector<int>> adj;
+// Topological sort of a directed CSR graph
+// The iterative DFS engine calls finish(node) after all descendants are visited;
+// finished nodes are written into the answer from the back, which is exactly the stack order.
+vector<int> topoSort(const CSRGraph& g) {
+    return dfsTopoSort(g);
+}
 
-// DFS function to perform topological sort
-void f(int node, vector<int>& vis, stack<int>& st) {
-    vis[node] = 1; // Mark the current node as visited
+// Reentrant version: the graph, the DFS scratch memory and the answer all belong to the caller.
+// No global state → safe to call from many threads at once (one workspace + answer per thread);
+// buffers are reused → no allocation once they are big enough.
+void topoSort(const CSRGraph& g, DFSWorkspace& ws, vector<int>& topoOrder) {
+    dfsTopoSort(g, ws, topoOrder);
+}
 
-    // Visit all unvisited adjacent nodes
-    for (auto it : adj[node]) {
-        if (!vis[it]) {
-            f(it, vis, st); // Recursive DFS call
+// Every edge u -> v must have u before v
+bool isTopoOrder(const CSRGraph& g, const vector<int>& order, vector<int>& pos) {
+    pos.resize(g.V);
+    for (int i = 0; i < g.V; i++) pos[order[i]] = i;
+    for (int u = 0; u < g.V; u++) {
+        for (int v : g.neighbors(u)) {
+            if (pos[u] > pos[v]) return false;
         }
     }
-
-    st.push(node); // Push the node to stack after visiting all descendants
+    return true;
 }
 
-// Main function to perform topological sort
+// Main function to perform topological sort from an edge list
 vector<int> topoSort(int V, vector<vector<int>>& edges) {
-    // Build the adjacency list from edges
-    for (auto it : edges) {
-        int x = it[0], y = it[1];
-        adj[x].push_back(y); // Directed edge from x to y
-    }
-
-    stack<int> st;           // Stack to store the topological order
-    vector<int> vis(V, 0);   // Visited array to keep track of visited nodes
-
-    // Call DFS for each unvisited node
-    for (int i = 0; i < V; i++) {
-        if (!vis[i]) {
-            f(i, vis, st);
-        }
-    }
+    // Build the CSR graph from edges (directed edge from x to y)
+    return topoSort(buildCSR(V, edges));
+}
 
-    // Extract topological order from the stack
-    vector<int> ans;
-    while (!st.empty()) {
-        ans.push_back(st.top());
-        st.pop();
-    }
+// Same, for a flat array of {u, v} structs (8 bytes per edge, read in place)
+vector<int> topoSort(int V, ArrayView<EdgeUV> edges) {
+    return topoSort(buildCSR(V, edges));
+}
 
-    return ans; // Return the final topological order
+// Same, for separate u[] / v[] columns
+vector<int> topoSort(int V, const EdgeColumns& edges) {
+    return topoSort(buildCSR(V, edges));
 }
 
 int main(){
@@ -75,20 +76,54 @@ int main(){
         {5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}
     };
 
-    vector<int> topoOrder = topoSort(V, edges);
+    // Build the graph once, then run the sort on it
+    CSRGraph g = buildCSR(V, edges);
+    vector<int> topoOrder = topoSort(g);
 
     cout << "Topological Sort: ";
     for (int node : topoOrder) {
         cout << node << " ";
     }
+    cout << endl;
+
+    // Reusing one workspace + answer: the first call sizes the buffers, later calls reuse them
+    DFSWorkspace ws;
+    vector<int> order;
+    topoSort(g, ws, order);
+    const void* buffers[3] = {ws.state.data(), ws.stack.data(), order.data()};
+    for (int i = 0; i < 1000; i++) topoSort(g, ws, order);
+    bool reused = buffers[0] == ws.state.data() && buffers[1] == ws.stack.data() && buffers[2] == order.data();
+    cout << "1000 more calls reused the same buffers: " << (reused ? "yes" : "no") << endl;
+
+    // Many threads at once, each with its own workspace, sorting its own random DAGs
+    int numThreads = 4, graphsPerThread = 50;
+    vector<CSRGraph> dags;
+    for (int i = 0; i < numThreads * graphsPerThread; i++) {
+        dags.push_back(buildCSR(2000, randomDagEdges(2000, 8000, i + 1)));
+    }
+
+    atomic<int> valid(0);
+    vector<thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t] {
+            DFSWorkspace myWs;
+            vector<int> myOrder, pos;
+            for (int i = t; i < (int)dags.size(); i += numThreads) {
+                topoSort(dags[i], myWs, myOrder);
+                if (isTopoOrder(dags[i], myOrder, pos)) valid++;
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    cout << numThreads << " threads sorted " << valid << " / " << dags.size() << " DAGs correctly" << endl;
 
     return 0;
 }
 
 
 // Time Complexity (TC)
-// Building adjacency list:
-// Iterates over all edges once → O(E)
+// Building CSR graph:
+// Iterates over all edges twice (count + fill) → O(V + E)
 
 // DFS traversal:
 // Each vertex is visited once → O(V)
@@ -98,13 +133,14 @@ int main(){
 // O(V + E)
 
 // Space Complexity (SC)
-// Adjacency list: Stores all edges → O(V + E)
+// CSR graph: Stores all edges contiguously → O(V + E)
 
 // Visited array: Stores visited status for each node → O(V)
 
-// Call stack for DFS recursion: In worst case, recursion depth can be O(V) → O(V)
+// Explicit DFS stack (no recursion): In worst case, depth can be O(V) → O(V)
 
-// Stack to store topological order: Stores all nodes → O(V)
+// Answer array filled from the back: Stores all nodes → O(V)
+// (reentrant version: workspace + answer are owned by the caller and reused, so no allocation)
 
 // Total space complexity:
 // O(V + E)
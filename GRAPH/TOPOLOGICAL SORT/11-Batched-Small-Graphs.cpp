@@ -0,0 +1,133 @@
+// 📦 Batched Topological Sort / Cycle Check on MANY SMALL graphs
+// Dependency checkers, build tools and query planners ask "is this a DAG? in which order?" for
+// hundreds of thousands of tiny graphs (10 – 200 nodes) per second. Calling topoSort(V, edges)
+// in a loop spends most of its time in malloc/free: every call builds a new adjacency structure,
+// in-degree array, visited arrays and queue, and then throws them away.
+
+// 🧠 Batch API (batch_topo.h)
+// 1. All graphs go into ONE GraphBatch: a flat (u, v) edge buffer + vertex / edge offsets.
+// 2. Each thread owns one SmallGraphArena: CSR arrays + in-degrees sized for the largest graph
+//    it has seen so far → reused for every graph, no allocation after warm-up.
+// 3. Graphs are handed out to the threads in chunks (ChunkQueue), results are written straight
+//    into one flat output array at the graph's vertex offset (no locks, no per-graph vectors).
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/dfs_engine.h"
+#include "../CORE/parallel.h"
+#include "kahn.h"         // kahnTopoSort (baseline)
+#include "batch_topo.h"
+using namespace std;
+
+// One random small graph: a random DAG on V vertices, optionally with one back edge (→ a cycle)
+vector<vector<int>> randomSmallGraph(int V, int E, bool addCycle, mt19937& rng) {
+    vector<int> label(V);
+    for (int i = 0; i < V; i++) label[i] = i;
+    shuffle(label.begin(), label.end(), rng);
+
+    vector<vector<int>> edges;
+    for (int i = 0; i < E; i++) {
+        int a = rng() % V, b = rng() % V;
+        if (a == b) continue;
+        if (a > b) swap(a, b);
+        edges.push_back({label[a], label[b]});   // Lower rank → higher rank: acyclic
+    }
+    if (addCycle && !edges.empty()) edges.push_back({edges[0][1], edges[0][0]});
+    return edges;
+}
+
+int main(int argc, char** argv) {
+    // Small example: the DAG of 2-Using-Kahn's-Algo(BFS).cpp and the cycle of 4-Cycle_detect-DG(BFS).cpp
+    GraphBatch batch;
+    batch.add(6, {{5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}});
+    vector<EdgeUV> cycleEdges = {{0, 1}, {1, 2}, {2, 3}, {3, 1}};   // Flat {u, v} array works too
+    batch.add(4, cycleEdges);
+
+    ThreadPool pool;
+    BatchTopoSorter sorter(pool);
+    BatchTopoResult res;
+    sorter.topoSort(batch, res);
+    for (int i = 0; i < batch.size(); i++) {
+        cout << "Graph " << i << ": ";
+        if (res.hasCycle[i]) {
+            cout << "cycle detected" << endl;
+            continue;
+        }
+        for (int k = 0; k < batch.numVertices(i); k++) cout << res.order[batch.vertexOffsets[i] + k] << " ";
+        cout << endl;
+    }
+
+    // 📈 Many small graphs: loop over the one-graph functions vs the batch API
+    int numGraphs = argc > 1 ? atoi(argv[1]) : 50000;
+    mt19937 rng(7);
+    vector<int> sizes;
+    vector<vector<vector<int>>> graphs;
+    batch.clear();
+    for (int i = 0; i < numGraphs; i++) {
+        int V = 10 + rng() % 191;                                // 10 .. 200 vertices
+        graphs.push_back(randomSmallGraph(V, 2 * V, i % 4 == 0, rng));   // Every 4th graph has a cycle
+        sizes.push_back(V);
+        batch.add(V, graphs.back());
+    }
+    cout << endl << numGraphs << " graphs, " << batch.totalVertices() << " vertices, "
+         << batch.edges.size() << " edges in total" << endl;
+
+    auto report = [&](const string& name, double ms) {
+        cout << name << ms << " ms, " << (long long)(numGraphs / (ms / 1000)) << " graphs/sec" << endl;
+    };
+
+    // Baseline 1: topoSort(V, edges) in a loop (build CSR + Kahn's, fresh vectors every call)
+    vector<vector<int>> loopOrders(numGraphs);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < numGraphs; i++) loopOrders[i] = kahnTopoSort(buildCSR(sizes[i], graphs[i]));
+    report("topoSort loop:            ", chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+
+    // Baseline 2: hasCycle(V, edges) in a loop (build CSR + DFS)
+    vector<char> loopCycles(numGraphs);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < numGraphs; i++) loopCycles[i] = hasDirectedCycle(buildCSR(sizes[i], graphs[i]));
+    report("hasCycle loop:            ", chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+    for (int T = 1;; T = min(T * 2, maxThreads)) {
+        ThreadPool threads(T);
+        BatchTopoSorter batchSorter(threads);
+
+        start = chrono::steady_clock::now();
+        batchSorter.topoSort(batch, res);
+        report("Batch topoSort, " + to_string(T) + " thread(s): ",
+               chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+
+        vector<char> cycles;
+        start = chrono::steady_clock::now();
+        batchSorter.hasCycle(batch, cycles);
+        report("Batch hasCycle, " + to_string(T) + " thread(s): ",
+               chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+
+        bool same = cycles == loopCycles;
+        for (int i = 0; i < numGraphs && same; i++) {
+            // Both are Kahn's with the same neighbor order → identical orders
+            same = res.hasCycle[i] == loopCycles[i] &&
+                   (res.hasCycle[i] || equal(loopOrders[i].begin(), loopOrders[i].end(),
+                                             res.order.begin() + batch.vertexOffsets[i]));
+        }
+        cout << "  same answers as the loop: " << (same ? "yes" : "NO") << endl;
+        if (T == maxThreads) break;
+    }
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// O(V + E) per graph for both versions; the batch version removes the allocations
+// (several malloc / free per graph) and splits the graphs among the threads.
+
+// 🧠 Space Complexity (SC):
+// Batch → O(total V + total E) in three flat arrays
+// Scratch → one arena per thread, O(largest V + largest E) each
@@ -0,0 +1,138 @@
+// 🎯 Reachability Queries on a DAG ("can u reach v?")
+// After a topological sort, dependency tools keep asking "does task u (transitively) feed task v?".
+// Answering each question with a fresh BFS / DFS costs O(V + E) per query.
+// reachability.h builds an index ONCE from the topological order and answers most queries in O(1).
+
+// 🧠 Layers of the index (all cheap necessary conditions for u ⇝ v)
+// 1. Topological position and Kahn level: u must come earlier and sit on a lower level than v.
+// 2. GRAIL interval labels: k randomized DFS orders; u ⇝ v requires interval(v) ⊆ interval(u).
+//    Almost all "no" answers (the common case in a big sparse DAG) stop here.
+// 3. Small DAG → a full bitset transitive closure instead: every answer is one bit test.
+// 4. Large DAG and all labels say "maybe" → DFS from u that never enters a vertex whose labels
+//    already rule out v (pruned DFS).
+
+// 📏 Measured on one core: the small DAG (closure) answers in ~8 ns / query, and the label check
+// alone costs tens of ns. On the 2^18-vertex random DAG the average is ~200 ns / query, NOT tens
+// of ns: the queries the labels cannot decide pay for a pruned DFS, and those dominate the mean.
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "../CORE/generators.h"
+#include "reachability.h"
+using namespace std;
+
+// Baseline: a fresh BFS from u per query (new visited array + queue every time)
+bool reachesBFS(const CSRGraph& g, int u, int v) {
+    vector<bool> visited(g.V, false);
+    queue<int> q;
+    q.push(u);
+    visited[u] = true;
+    while (!q.empty()) {
+        int x = q.front();
+        q.pop();
+        if (x == v) return true;
+        for (int w : g.neighbors(x)) {
+            if (!visited[w]) {
+                visited[w] = true;
+                q.push(w);
+            }
+        }
+    }
+    return false;
+}
+
+// Half random pairs, half pairs found by a random walk (so they are reachable)
+vector<pair<int, int>> makeQueries(const CSRGraph& g, int count, unsigned seed) {
+    mt19937 rng(seed);
+    vector<pair<int, int>> queries;
+    while ((int)queries.size() < count) {
+        int u = rng() % g.V, v = rng() % g.V;
+        if (queries.size() % 2) {
+            v = u;
+            for (int step = 0; step < 8 && g.neighbors(v).size() > 0; step++) {
+                v = g.adj[g.offsets[v] + rng() % g.neighbors(v).size()];
+            }
+        }
+        queries.push_back({u, v});
+    }
+    return queries;
+}
+
+void benchmark(const string& name, const CSRGraph& g, ThreadPool& pool, int numQueries, int baselineQueries) {
+    DAGReachability index;
+    auto start = chrono::steady_clock::now();
+    index.build(g, pool);
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    vector<pair<int, int>> queries = makeQueries(g, numQueries, 3);
+    ReachWorkspace ws;
+    vector<char> answers(numQueries);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < numQueries; i++) answers[i] = index.reaches(queries[i].first, queries[i].second, ws);
+    double indexNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / numQueries;
+
+    // Label check alone (no closure, no DFS): the cost of the queries the labels can decide
+    int yes = 0, decided = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < numQueries; i++) {
+        decided += queries[i].first != queries[i].second && !index.mayReach(queries[i].first, queries[i].second);
+    }
+    double labelNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / numQueries;
+    for (int i = 0; i < numQueries; i++) yes += answers[i];
+
+    bool same = true;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < baselineQueries; i++) {
+        same = same && reachesBFS(g, queries[i].first, queries[i].second) == (bool)answers[i];
+    }
+    double bfsNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / baselineQueries;
+
+    cout << endl << name << " (V = " << g.V << ", E = " << g.numEdges() << ")" << endl;
+    cout << "Index build (" << pool.size() << " thread(s)): " << buildMs << " ms, "
+         << index.memoryBytes() / (1 << 20) << " MiB" << (index.hasClosure() ? ", bitset closure" : "") << endl;
+    cout << "Queries: " << numQueries << ", reachable: " << yes << ", answered 'no' by labels alone: " << decided << endl;
+    cout << "Index:     " << indexNs << " ns / query (labels only: " << labelNs << " ns)" << endl;
+    cout << "Fresh BFS: " << bfsNs << " ns / query (first " << baselineQueries << " queries, same answers: "
+         << (same ? "yes" : "NO") << ")" << endl;
+}
+
+int main(int argc, char** argv) {
+    ThreadPool pool;
+
+    // Small example: same DAG as 2-Using-Kahn's-Algo(BFS).cpp
+    vector<vector<int>> edges = {{5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}};
+    CSRGraph g = buildCSR(6, edges);
+    DAGReachability index(2, 0);   // No closure → labels + pruned DFS
+    index.build(g, pool);
+    cout << "5 reaches 1: " << (index.reaches(5, 1) ? "yes" : "no") << endl;   // 5 -> 2 -> 3 -> 1
+    cout << "4 reaches 3: " << (index.reaches(4, 3) ? "yes" : "no") << endl;
+    cout << "2 reaches 0: " << (index.reaches(2, 0) ? "yes" : "no") << endl;
+
+    // Cyclic input is refused
+    CSRGraph cyclic = buildCSR(4, vector<vector<int>>{{0, 1}, {1, 2}, {2, 3}, {3, 1}});
+    DAGReachability refused;
+    cout << "Index on a cyclic graph: " << (refused.build(cyclic, pool) ? "built" : "refused (cycle)")
+         << ", later query answers: " << (refused.reaches(0, 1) ? "yes" : "no") << endl;
+
+    // 📈 Large sparse DAG (labels + pruned DFS) and a small dense one (bitset closure)
+    int V = argc > 1 ? atoi(argv[1]) : 1 << 18;
+    benchmark("Random DAG", buildCSR(V, randomDagEdges(V, 2LL * V, 9), true, false), pool, 1000000, 200);
+    benchmark("Small DAG", buildCSR(4000, randomDagEdges(4000, 16000, 10), true, false), pool, 1000000, 20000);
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Build → k DFS passes + parallel Kahn's → O(k (V + E)); closure O(E * V / 64) (small DAGs)
+// Query → O(1) when a label or the closure decides, pruned DFS otherwise
+// Fresh BFS per query → O(V + E) every time
+
+// 🧠 Space Complexity (SC):
+// O((k + 2) V) for the labels, O(V² / 64) for the closure
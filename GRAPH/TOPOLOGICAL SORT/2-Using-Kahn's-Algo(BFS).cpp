@@ -12,52 +12,50 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "kahn.h"   // kahnTopoSort, hasCycleKahn, kahnTopoSortParallel
 using namespace std;
 
-// Function to perform Topological Sort using Kahn's Algorithm (BFS)
-vector<int> topoSort(int V, vector<vector<int>>& edges) {
-    vector<vector<int>> adj(V);       // Adjacency list to represent the graph
-    vector<int> indegree(V, 0);       // Array to store in-degrees of all vertices
-
-    // Build the graph (adjacency list) and compute in-degrees
-    for (auto edge : edges) {
-        int u = edge[0], v = edge[1];
-        adj[u].push_back(v);          // Edge from u -> v
-        indegree[v]++;                // Increment in-degree of destination vertex
-    }
-
-    queue<int> q;                     // Queue to store vertices with in-degree 0
-    vector<int> result;              // Vector to store topological order
+// Function to perform Topological Sort using Kahn's Algorithm (BFS) on a CSR graph
+vector<int> topoSort(const CSRGraph& g) {
+    vector<int> result = kahnTopoSort(g);
 
-    // Push all vertices with in-degree 0 into the queue
-    for (int i = 0; i < V; ++i) {
-        if (indegree[i] == 0)
-            q.push(i);
+    // If result does not contain all vertices, the graph has a cycle
+    if ((int)result.size() != g.V) {
+        cout << "Cycle detected! Topological sort not possible.\n";
     }
 
-    // Process nodes with in-degree 0 and reduce in-degrees of neighbors
-    while (!q.empty()) {
-        int node = q.front();
-        q.pop();
-        result.push_back(node);       // Add current node to topological order
-
-        // Reduce the in-degree of all adjacent vertices
-        for (int neighbor : adj[node]) {
-            indegree[neighbor]--;
-            if (indegree[neighbor] == 0) {
-                q.push(neighbor);     // If in-degree becomes 0, add to queue
-            }
-        }
-    }
+    return result; // Return the topological sort order
+}
+
+// Parallel mode: every ready frontier is processed by all threads of the pool (see 7-Parallel-Kahn.cpp).
+// level[v] receives the longest-path depth of v.
+vector<int> topoSort(const CSRGraph& g, ThreadPool& pool, vector<int>& level) {
+    ParallelKahnResult res = kahnTopoSortParallel(g, pool);
+    level = res.level;
 
-    // If result contains all vertices, a valid topological sort exists
-    if (result.size() != V) {
+    if (res.hasCycle) {
         cout << "Cycle detected! Topological sort not possible.\n";
         return {};
     }
 
-    return result; // Return the topological sort order
+    return res.order;
+}
+
+// Edge-list version: builds the CSR graph (edge from u -> v) and sorts it
+vector<int> topoSort(int V, vector<vector<int>>& edges) {
+    return topoSort(buildCSR(V, edges));
+}
+
+// Compact input: contiguous {u, v} edges (vector<EdgeUV>, a chunk from a file, ...)
+vector<int> topoSort(int V, ArrayView<EdgeUV> edges) {
+    return topoSort(buildCSR(V, edges));
+}
+
+// Struct-of-arrays input: u[] and v[] columns
+vector<int> topoSort(int V, const EdgeColumns& edges) {
+    return topoSort(buildCSR(V, edges));
 }
 
 int main() {
@@ -68,14 +66,26 @@ int main() {
         {5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}
     };
 
-    // Get topological sort order
-    vector<int> topoOrder = topoSort(V, edges);
+    // Build the graph once, then get topological sort order
+    CSRGraph g = buildCSR(V, edges);
+    vector<int> topoOrder = topoSort(g);
 
     // Print the result
     cout << "Topological Sort (Kahn's Algorithm): ";
     for (int node : topoOrder) {
         cout << node << " ";
     }
+    cout << endl;
+
+    // Same graph, parallel mode (also returns every vertex's level)
+    ThreadPool pool;
+    vector<int> level;
+    topoOrder = topoSort(g, pool, level);
+    cout << "Topological Sort (parallel): ";
+    for (int node : topoOrder) {
+        cout << node << "(level " << level[node] << ") ";
+    }
+    cout << endl;
 
     return 0;
 }
@@ -83,8 +93,8 @@ int main() {
 
 
 // Time Complexity (TC)
-// Building adjacency list and indegree array:
-// Iterates over all edges once → O(E)
+// Building CSR graph and indegree array:
+// Iterates over all edges a constant number of times → O(V + E)
 
 // Processing nodes with in-degree 0:
 // Each node is pushed and popped from the queue once → O(V)
@@ -94,7 +104,7 @@ int main() {
 // O(V + E)
 
 // Space Complexity (SC)
-// Adjacency list: Stores all edges → O(V + E)
+// CSR graph: Stores all edges contiguously → O(V + E)
 
 // Indegree array: Stores indegree for each vertex → O(V)
 
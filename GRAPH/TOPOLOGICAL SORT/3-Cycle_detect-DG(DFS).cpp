@@ -3,48 +3,36 @@
 
 #include <iostream>
 #include <vector>
+#include "../CORE/csr_graph.h"
+#include "../CORE/dfs_engine.h"
 using namespace std;
 
-// DFS function to detect a cycle
-bool dfs(int node, vector<vector<int>>& adj, vector<int>& vis, vector<int>& dfsVis) {
-    vis[node] = 1;       // Mark node as visited
-    dfsVis[node] = 1;    // Mark node as part of current DFS path
-
-    // Visit all neighbors
-    for (int neighbor : adj[node]) {
-        if (!vis[neighbor]) {
-            // If neighbor not visited, recur
-            if (dfs(neighbor, adj, vis, dfsVis))
-                return true;
-        } else if (dfsVis[neighbor]) {
-            // If neighbor is in current DFS path → cycle
-            return true;
-        }
-    }
+// Check for cycle in a directed CSR graph
+// The iterative DFS engine keeps the "current path" as GRAY vertices (the old dfsVis array);
+// an edge into a GRAY vertex is a back edge → cycle.
+bool hasCycle(const CSRGraph& g) {
+    return hasDirectedCycle(g);
+}
 
-    dfsVis[node] = 0;    // Backtrack: remove from current DFS path
-    return false;
+// Same check, but returns the cycle itself (c[0] -> c[1] -> ... -> c[0]), empty if there is none.
+// The back edge u -> v that proves the cycle also tells where it is: v ... u is the GRAY path.
+vector<int> findCycle(const CSRGraph& g) {
+    return findDirectedCycle(g);
 }
 
-// Main function to check for cycle in a directed graph
+// Main function to check for cycle in a directed graph given as an edge list
 bool hasCycle(int V, vector<vector<int>>& edges) {
-    vector<vector<int>> adj(V);      // Adjacency list
-    for (auto& edge : edges) {
-        int u = edge[0], v = edge[1];
-        adj[u].push_back(v);         // Directed edge from u -> v
-    }
-
-    vector<int> vis(V, 0), dfsVis(V, 0);  // Visited and recursion stack arrays
+    return hasCycle(buildCSR(V, edges));  // Directed edge from u -> v
+}
 
-    // Call DFS from every unvisited node
-    for (int i = 0; i < V; ++i) {
-        if (!vis[i]) {
-            if (dfs(i, adj, vis, dfsVis))
-                return true;  // Cycle detected
-        }
-    }
+// Directed edges given as a contiguous {u, v} array
+bool hasCycle(int V, ArrayView<EdgeUV> edges) {
+    return hasCycle(buildCSR(V, edges));
+}
 
-    return false;  // No cycle found
+// Directed edges given as u[] / v[] columns
+bool hasCycle(int V, const EdgeColumns& edges) {
+    return hasCycle(buildCSR(V, edges));
 }
 
 int main() {
@@ -53,18 +41,27 @@ int main() {
         {0, 1}, {1, 2}, {2, 3}, {3, 1}  // Creates a cycle: 1 → 2 → 3 → 1
     };
 
-    if (hasCycle(V, edges))
+    CSRGraph g = buildCSR(V, edges);  // Build the graph once
+
+    if (hasCycle(g))
         cout << "Cycle detected in the graph.\n";
     else
         cout << "No cycle found. It's a DAG.\n";
 
+    vector<int> cycle = findCycle(g);
+    if (!cycle.empty()) {
+        cout << "Cycle: ";
+        for (int v : cycle) cout << v << " -> ";
+        cout << cycle[0] << "\n";
+    }
+
     return 0;
 }
 
 
 // Time Complexity (TC)
-// Building adjacency list:
-// Iterates over all edges once → O(E)
+// Building CSR graph:
+// Iterates over all edges twice (count + fill) → O(V + E)
 
 // DFS traversal:
 // Each vertex is visited once → O(V)
@@ -74,11 +71,11 @@ int main() {
 // O(V + E)
 
 // Space Complexity (SC)
-// Adjacency list: Stores all edges → O(V + E)
+// CSR graph: Stores all edges contiguously → O(V + E)
 
-// Visited arrays (vis and dfsVis): Two arrays of size V → O(V)
+// Color array (WHITE / GRAY / BLACK replaces vis and dfsVis): size V → O(V)
 
-// Call stack for DFS recursion: Maximum depth O(V) → O(V)
+// Explicit DFS stack (no recursion): Maximum depth O(V) → O(V)
 
 // Total space complexity:
 // O(V + E)
@@ -7,47 +7,33 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "kahn.h"   // hasCycleKahn, hasCycleKahnParallel
 using namespace std;
 
-// Function to detect cycle using Kahn's Algorithm (BFS-based topological sort)
+// Function to detect cycle using Kahn's Algorithm (BFS-based topological sort) on a CSR graph
+// If not all nodes can be processed (some in-degree never reaches 0), a cycle exists
+bool hasCycle(const CSRGraph& g) {
+    return hasCycleKahn(g);
+}
+
+// Parallel mode: same check, each ready frontier is processed by all threads of the pool
+bool hasCycle(const CSRGraph& g, ThreadPool& pool) {
+    return hasCycleKahnParallel(g, pool);
+}
+
+// Edge-list version: builds the CSR graph (edge from u -> v) and checks it
 bool hasCycle(int V, vector<vector<int>>& edges) {
-    vector<vector<int>> adj(V);       // Adjacency list representation of the graph
-    vector<int> indegree(V, 0);       // Array to store in-degrees of all vertices
-
-    // Build the graph and calculate in-degrees
-    for (auto& edge : edges) {
-        int u = edge[0], v = edge[1];
-        adj[u].push_back(v);          // Add edge from u -> v
-        indegree[v]++;                // Increase in-degree of destination node
-    }
-
-    queue<int> q;                     // Queue for nodes with in-degree 0
-    int count = 0;                    // Count of processed nodes
-
-    // Push all nodes with in-degree 0 to the queue
-    for (int i = 0; i < V; ++i) {
-        if (indegree[i] == 0)
-            q.push(i);
-    }
-
-    // Process the nodes using BFS
-    while (!q.empty()) {
-        int node = q.front();
-        q.pop();
-        count++;                      // Increment count of processed nodes
-
-        // Decrease in-degree of all adjacent nodes
-        for (int neighbor : adj[node]) {
-            indegree[neighbor]--;
-            if (indegree[neighbor] == 0) {
-                q.push(neighbor);     // If in-degree becomes 0, add to queue
-            }
-        }
-    }
-
-    // If not all nodes were processed, a cycle exists
-    return count != V;
+    return hasCycle(buildCSR(V, edges));
+}
+
+bool hasCycle(int V, ArrayView<EdgeUV> edges) {
+    return hasCycle(buildCSR(V, edges));
+}
+
+bool hasCycle(int V, const EdgeColumns& edges) {
+    return hasCycle(buildCSR(V, edges));
 }
 
 int main() {
@@ -58,19 +44,27 @@ int main() {
         {0, 1}, {1, 2}, {2, 3}, {3, 1}  // Creates a cycle: 1 → 2 → 3 → 1
     };
 
+    CSRGraph g = buildCSR(V, edges);  // Build the graph once
+
     // Check for cycle
-    if (hasCycle(V, edges))
+    if (hasCycle(g))
         cout << "Cycle detected in the graph.\n";
     else
         cout << "No cycle found. It's a DAG.\n";
 
+    ThreadPool pool;
+    if (hasCycle(g, pool))
+        cout << "Cycle detected in the graph (parallel check).\n";
+    else
+        cout << "No cycle found. It's a DAG (parallel check).\n";
+
     return 0;
 }
 
 
 // Time Complexity (TC)
-// Building adjacency list and indegree array:
-// Iterate over all edges once → O(E)
+// Building CSR graph and indegree array:
+// Iterate over all edges a constant number of times → O(V + E)
 
 // Processing nodes in BFS:
 // Each vertex is enqueued and dequeued at most once → O(V)
@@ -80,7 +74,7 @@ int main() {
 // O(V + E)
 
 // Space Complexity (SC)
-// Adjacency list: Stores all edges → O(V + E)
+// CSR graph: Stores all edges contiguously → O(V + E)
 
 // Indegree array: Stores indegree for each vertex → O(V)
 
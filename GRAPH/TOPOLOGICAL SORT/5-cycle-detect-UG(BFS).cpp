@@ -7,51 +7,29 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
+#include "../CORE/csr_graph.h"
+#include "cycle_bfs.h"   // hasUndirectedCycleBFS
 using namespace std;
 
-// Function to detect cycle in an undirected graph using BFS
+// Function to detect cycle in an undirected CSR graph (both directions stored) using BFS
+// A visited neighbor that is not the BFS parent means a second path → cycle
+bool isCycle(const CSRGraph& g) {
+    return hasUndirectedCycleBFS(g);
+}
+
+// Edge-list version: builds an undirected CSR graph (u -> v and v -> u) and checks it
 bool isCycle(int V, vector<vector<int>>& edges) {
-    // Build adjacency list representation of the graph
-    vector<vector<int>> adj(V);
-    for (auto& edge : edges) {
-        int u = edge[0], v = edge[1];
-        adj[u].push_back(v);   // Add edge u -> v
-        adj[v].push_back(u);   // Add edge v -> u (undirected graph)
-    }
-
-    vector<bool> visited(V, false);  // Track visited nodes
-
-    // Check each connected component of the graph
-    for (int i = 0; i < V; i++) {
-        if (!visited[i]) {  // If node not visited yet
-            queue<pair<int, int>> q; // Queue stores pairs of (node, parent)
-            q.push({i, -1});          // Start BFS from node i with no parent
-            visited[i] = true;        // Mark node as visited
-
-            while (!q.empty()) {
-                int node = q.front().first;    // Current node
-                int parent = q.front().second; // Parent of current node
-                q.pop();
-
-                // Traverse all adjacent nodes
-                for (int neighbor : adj[node]) {
-                    if (!visited[neighbor]) {
-                        // If neighbor not visited, mark visited and add to queue
-                        visited[neighbor] = true;
-                        q.push({neighbor, node});
-                    }
-                    else if (neighbor != parent) {
-                        // If neighbor is visited and not parent, cycle detected
-                        return true;
-                    }
-                }
-            }
-        }
-    }
-
-    // If no cycle found after BFS on all components
-    return false;
+    return isCycle(buildCSR(V, edges, false));
+}
+
+// Undirected edges from a contiguous {u, v} array
+bool isCycle(int V, ArrayView<EdgeUV> edges) {
+    return isCycle(buildCSR(V, edges, false));
+}
+
+// Undirected edges from u[] / v[] columns
+bool isCycle(int V, const EdgeColumns& edges) {
+    return isCycle(buildCSR(V, edges, false));
 }
 
 int main() {
@@ -63,7 +41,9 @@ int main() {
         {0, 1}, {1, 2}, {2, 3}, {3, 0}, {3, 4}
     };
 
-    if (isCycle(V, edges))
+    CSRGraph g = buildCSR(V, edges, false);  // Undirected: store both directions
+
+    if (isCycle(g))
         cout << "Cycle detected in the undirected graph.\n";
     else
         cout << "No cycle found in the undirected graph.\n";
@@ -73,11 +53,11 @@ int main() {
 
 
 // Time Complexity:
-// Building adjacency list: O(E)
+// Building CSR graph: O(V + E)
 
 // BFS visits each vertex once and edges once: O(V + E)
 
 // Space Complexity:
-// Adjacency list: O(V + E)
+// CSR graph: O(V + E)
 
 // Visited array and queue: O(V)
\ No newline at end of file
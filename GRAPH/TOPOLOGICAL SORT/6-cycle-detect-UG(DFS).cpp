@@ -8,45 +8,29 @@
 
 #include <iostream>
 #include <vector>
+#include "../CORE/csr_graph.h"
+#include "../CORE/dfs_engine.h"
 using namespace std;
 
-// DFS function to detect cycle in an undirected graph
-bool dfs(int node, int parent, vector<vector<int>>& adj, vector<int>& visited) {
-    visited[node] = 1;  // Mark current node as visited
-
-    for (int neighbor : adj[node]) {
-        if (!visited[neighbor]) {
-            // Visit the neighbor recursively
-            if (dfs(neighbor, node, adj, visited))
-                return true;  // Cycle found in subtree
-        } else if (neighbor != parent) {
-            // If neighbor is visited and not parent, cycle detected
-            return true;
-        }
-    }
-    return false;
+// Function to check cycle in an undirected CSR graph (both directions stored)
+// Runs on the iterative DFS engine: a neighbor still on the DFS path that is not the parent → cycle
+bool hasCycle(const CSRGraph& g) {
+    return hasUndirectedCycle(g);
 }
 
-// Function to check cycle in an undirected graph
+// Function to check cycle in an undirected graph given as an edge list
 bool hasCycle(int V, vector<vector<int>>& edges) {
-    vector<vector<int>> adj(V);
-    vector<int> visited(V, 0);
-
-    // Build adjacency list
-    for (auto& edge : edges) {
-        int u = edge[0], v = edge[1];
-        adj[u].push_back(v);
-        adj[v].push_back(u);  // Undirected graph: add both ways
-    }
-
-    // Check for cycle in all connected components
-    for (int i = 0; i < V; i++) {
-        if (!visited[i]) {
-            if (dfs(i, -1, adj, visited))
-                return true;
-        }
-    }
-    return false;  // No cycle found
+    return hasCycle(buildCSR(V, edges, false));  // Undirected graph: add both ways
+}
+
+// Same check for a flat {u, v} edge array
+bool hasCycle(int V, ArrayView<EdgeUV> edges) {
+    return hasCycle(buildCSR(V, edges, false));
+}
+
+// Same check for u[] / v[] columns
+bool hasCycle(int V, const EdgeColumns& edges) {
+    return hasCycle(buildCSR(V, edges, false));
 }
 
 int main() {
@@ -56,7 +40,9 @@ int main() {
         {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 1}  // This contains a cycle
     };
 
-    if (hasCycle(V, edges))
+    CSRGraph g = buildCSR(V, edges, false);  // Undirected: store both directions
+
+    if (hasCycle(g))
         cout << "Cycle detected in the undirected graph.\n";
     else
         cout << "No cycle found. The graph is acyclic.\n";
@@ -65,13 +51,13 @@ int main() {
 }
 
 // Time Complexity:
-// Building adjacency list: O(E)
+// Building CSR graph: O(V + E)
 
 // DFS traversal (each node and edge visited once): O(V + E)
 
 // Space Complexity:
-// Adjacency list: O(V + E)
+// CSR graph: O(V + E)
 
 // Visited array: O(V)
 
-// Call stack (DFS recursion): up to O(V)
\ No newline at end of file
+// Explicit DFS stack (no recursion): up to O(V)
\ No newline at end of file
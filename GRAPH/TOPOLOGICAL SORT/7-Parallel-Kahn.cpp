@@ -0,0 +1,100 @@
+// 🧵 Parallel Kahn's Algorithm (level by level)
+// Serial Kahn's pops ONE zero-in-degree vertex at a time from a queue. But all vertices that are
+// ready at the same moment are independent of each other, so a whole "ready frontier" can be
+// removed at once by many threads. Build / task-dependency DAGs have millions of nodes and wide
+// levels, so there is a lot of parallel work per level.
+
+// 🧠 Steps (one round per level)
+// 1. In-degrees are counted in parallel with atomic fetch_add.
+// 2. Level 0 = all vertices with in-degree 0.
+// 3. Threads grab chunks of the current level; for every edge u -> v they do
+//    indegree[v].fetch_sub(1). The thread that sees the count go 1 → 0 owns v (exactly one thread
+//    does) and appends it to its OWN buffer.
+// 4. Barrier, then every thread copies its buffer into the answer right behind the current level
+//    (offset from the sizes of the lower-numbered buffers → no lock). That slice is the next level.
+// 5. Stop when a level is empty. Fewer than V vertices placed → cycle (same rule as serial Kahn's).
+
+// ✅ Output
+// order → a valid topological order (vertices of one level may come in any order)
+// level[v] → round in which v became ready = length of the longest path ending at v
+//            (the "depth" of a task: the minimum number of sequential steps before it can run)
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "../CORE/generators.h"
+#include "kahn.h"   // kahnTopoSort, kahnTopoSortParallel
+using namespace std;
+
+// Every edge u -> v has u before v, and v is at least one level deeper than u
+bool validResult(const CSRGraph& g, const ParallelKahnResult& res) {
+    if ((int)res.order.size() != g.V) return false;
+    vector<int> pos(g.V, -1);
+    for (int i = 0; i < g.V; i++) pos[res.order[i]] = i;
+    for (int u = 0; u < g.V; u++) {
+        for (int v : g.neighbors(u)) {
+            if (pos[u] > pos[v] || res.level[v] <= res.level[u]) return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    ThreadPool pool;
+
+    // Small example: same DAG as 2-Using-Kahn's-Algo(BFS).cpp
+    vector<vector<int>> edges = {{5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}};
+    CSRGraph g = buildCSR(6, edges);
+    ParallelKahnResult res = kahnTopoSortParallel(g, pool);
+
+    cout << "Topological Sort (parallel Kahn's): ";
+    for (int node : res.order) cout << node << " ";
+    cout << endl << "Levels: ";
+    for (int v = 0; v < g.V; v++) cout << v << ":" << res.level[v] << " ";
+    cout << endl;
+
+    // Cycle 1 -> 2 -> 3 -> 1 (same graph as 4-Cycle_detect-DG(BFS).cpp)
+    vector<vector<int>> cyclic = {{0, 1}, {1, 2}, {2, 3}, {3, 1}};
+    cout << (hasCycleKahnParallel(buildCSR(4, cyclic), pool) ? "Cycle detected in the graph." : "No cycle found.")
+         << endl;
+
+    // 📈 Scaling on a large random DAG
+    int V = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int degree = argc > 2 ? atoi(argv[2]) : 8;
+    CSRGraph dag = buildCSR(V, randomDagEdges(V, (long long)degree * V));
+
+    auto start = chrono::steady_clock::now();
+    vector<int> serial = kahnTopoSort(dag);
+    double serialMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << endl << "Random DAG (V = " << V << ", E = " << dag.numEdges() << ")" << endl;
+    cout << "Serial Kahn's: " << serialMs << " ms" << endl;
+    cout << "Threads\tTime (ms)\tLevels\tSpeedup vs serial\tValid" << endl;
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+    for (int T = 1;; T = min(T * 2, maxThreads)) {
+        ThreadPool team(T);
+        start = chrono::steady_clock::now();
+        ParallelKahnResult par = kahnTopoSortParallel(dag, team);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+        cout << T << "\t" << ms << "\t" << par.numLevels << "\t" << serialMs / ms << "\t"
+             << (validResult(dag, par) && !par.hasCycle ? "yes" : "NO") << endl;
+        if (T == maxThreads) break;
+    }
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Work is O(V + E) like serial Kahn's (every edge is decremented once).
+// With T threads and L levels: about O((V + E) / T + L * barrier cost).
+// Wide, shallow DAGs scale well; a long chain (L = V) has no parallelism at all.
+
+// 🧠 Space Complexity (SC):
+// Atomic in-degrees + levels → O(V), answer array (also used as the frontier) → O(V)
+// Per-thread buffers → O(largest level)
@@ -0,0 +1,120 @@
+// 🔄 Incremental Topological Order (edges arrive one at a time)
+// A scheduler that adds dependency edges one by one and needs a valid order after EVERY insert
+// would rerun topoSort each time → O(V + E) per insert.
+// The Pearce–Kelly algorithm (see dynamic_topo.h) keeps the order and repairs it locally:
+// only vertices whose positions lie between the two endpoints of the new edge can move.
+
+// 🧠 Steps for a new edge u -> v
+// 1. ord[u] < ord[v] → the order is still valid, nothing to do (the common case).
+// 2. Otherwise search forward from v (only vertices placed before u) and backward from u
+//    (only vertices placed after v).
+// 3. If the forward search reaches u, the edge closes a cycle → reject it and report the cycle.
+// 4. Else move everything that reaches u in front of everything reachable from v,
+//    reusing exactly the positions those vertices had.
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "../CORE/csr_graph.h"
+#include "../CORE/dfs_engine.h"
+#include "dynamic_topo.h"
+using namespace std;
+
+void printOrder(const DynamicTopoOrder& topo, const vector<string>& names) {
+    cout << "  Order: ";
+    for (int v : topo.order()) cout << names[v] << " ";
+    cout << endl;
+}
+
+int main(int argc, char** argv) {
+    // Small scheduler example: tasks get dependencies one by one
+    // (ids start out in the WRONG order, so the inserts have to move vertices around)
+    vector<string> names = {"package", "test", "link", "compile", "configure", "fetch"};
+    DynamicTopoOrder topo(names.size());
+
+    vector<pair<int, int>> deps = {
+        {2, 1},   // link -> test
+        {3, 2},   // compile -> link
+        {4, 3},   // configure -> compile
+        {5, 4},   // fetch -> configure
+        {1, 0},   // test -> package
+        {0, 4},   // package -> configure  ✗ would close configure -> compile -> link -> test -> package
+    };
+
+    for (auto& d : deps) {
+        vector<int> cycle;
+        cout << "Add " << names[d.first] << " -> " << names[d.second] << endl;
+        if (topo.addEdge(d.first, d.second, &cycle)) {
+            printOrder(topo, names);
+        } else {
+            cout << "  Rejected, it would create the cycle: ";
+            for (int v : cycle) cout << names[v] << " -> ";
+            cout << names[cycle[0]] << endl;
+        }
+    }
+    cout << "Position of link: " << topo.position(2) << endl;
+
+    // 📈 Incremental vs recomputing the whole order after every insert
+    int V = argc > 1 ? atoi(argv[1]) : 2000;
+    int inserts = argc > 2 ? atoi(argv[2]) : 8000;
+
+    // Random edges between a hidden order's vertices; a few go "backwards" and must be rejected
+    mt19937 rng(3);
+    vector<int> hidden(V);
+    for (int i = 0; i < V; i++) hidden[i] = i;
+    shuffle(hidden.begin(), hidden.end(), rng);
+    vector<pair<int, int>> stream;
+    while ((int)stream.size() < inserts) {
+        int a = rng() % V, b = rng() % V;
+        if (a == b) continue;
+        if ((a > b) != (rng() % 100 == 0)) swap(a, b);   // ~1% point the wrong way
+        stream.push_back({hidden[a], hidden[b]});
+    }
+
+    DynamicTopoOrder dyn(V);
+    int rejected = 0;
+    auto start = chrono::steady_clock::now();
+    for (auto& e : stream) {
+        if (!dyn.addEdge(e.first, e.second)) rejected++;
+    }
+    double incMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    // Baseline: add the edge, rebuild the graph, rerun the DFS topological sort + cycle check
+    vector<vector<int>> accepted;
+    int rejectedFull = 0;
+    start = chrono::steady_clock::now();
+    for (auto& e : stream) {
+        accepted.push_back({e.first, e.second});
+        CSRGraph g = buildCSR(V, accepted);
+        if (hasDirectedCycle(g)) {
+            accepted.pop_back();
+            rejectedFull++;
+            continue;
+        }
+        vector<int> order = dfsTopoSort(g);
+    }
+    double fullMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    // The final incremental order must respect every accepted edge
+    bool valid = true;
+    for (auto& e : accepted) valid = valid && dyn.before(e[0], e[1]);
+
+    cout << endl << V << " vertices, " << inserts << " edge inserts (" << rejected << " rejected)" << endl;
+    cout << "Incremental (Pearce-Kelly): " << incMs << " ms" << endl;
+    cout << "Recompute after each insert: " << fullMs << " ms (" << rejectedFull << " rejected)" << endl;
+    cout << "Final order valid: " << (valid && rejected == rejectedFull ? "yes" : "NO") << endl;
+
+    return 0;
+}
+
+
+// ⏱ Time Complexity (TC):
+// Per insert: O(1) when the edge agrees with the order, otherwise proportional to the
+// affected region only (never more than the O(V + E) of a full recomputation, usually far less).
+// Order / position queries → O(1).
+
+// 🧠 Space Complexity (SC):
+// In- and out-adjacency lists → O(V + E), order arrays + search scratch → O(V)
@@ -0,0 +1,157 @@
+// 📦 Batched topological sort / cycle check for MANY SMALL graphs (explained in 11-Batched-Small-Graphs.cpp)
+// All graphs of a batch live in ONE flat edge buffer:
+//   graph i has vertexOffsets[i + 1] - vertexOffsets[i] vertices (numbered 0 .. V-1 inside the graph)
+//   and the edges edges[edgeOffsets[i] .. edgeOffsets[i + 1])
+// Results use the same vertex offsets: the order of graph i is order[vertexOffsets[i] ...].
+
+// 🧠 Every thread owns one SmallGraphArena (CSR arrays + in-degrees). The arena only grows to the
+// biggest graph it has seen, so after warm-up a graph costs no allocation at all, just the work.
+// The order output doubles as Kahn's queue (head = vertices already output, tail = ready ones).
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "../CORE/csr_graph.h"   // EdgeUV, ArrayView
+#include "../CORE/parallel.h"
+using namespace std;
+
+struct GraphBatch {
+    vector<long long> vertexOffsets = {0};   // Prefix sums of the vertex counts
+    vector<long long> edgeOffsets = {0};     // Prefix sums of the edge counts
+    vector<pair<int, int>> edges;            // (u, v) of all graphs, graph after graph
+
+    int size() const { return (int)vertexOffsets.size() - 1; }
+    int numVertices(int i) const { return (int)(vertexOffsets[i + 1] - vertexOffsets[i]); }
+    long long totalVertices() const { return vertexOffsets.back(); }
+
+    // Append one graph given as an edge list {u, v}
+    void add(int V, const vector<vector<int>>& graphEdges) {
+        for (auto& e : graphEdges) edges.push_back({e[0], e[1]});
+        vertexOffsets.push_back(vertexOffsets.back() + V);
+        edgeOffsets.push_back(edges.size());
+    }
+
+    // Same, from a contiguous {u, v} array (a vector<EdgeUV>, a chunk of an edge file, ...)
+    void add(int V, ArrayView<EdgeUV> graphEdges) {
+        for (const EdgeUV& e : graphEdges) edges.push_back({e.u, e.v});
+        vertexOffsets.push_back(vertexOffsets.back() + V);
+        edgeOffsets.push_back(edges.size());
+    }
+
+    // Same, from u[] / v[] columns
+    void add(int V, const EdgeColumns& graphEdges) {
+        for (size_t i = 0; i < graphEdges.size(); i++) edges.push_back({graphEdges.u[i], graphEdges.v[i]});
+        vertexOffsets.push_back(vertexOffsets.back() + V);
+        edgeOffsets.push_back(edges.size());
+    }
+
+    void clear() {
+        vertexOffsets.assign(1, 0);
+        edgeOffsets.assign(1, 0);
+        edges.clear();
+    }
+};
+
+struct BatchTopoResult {
+    vector<int> order;       // Topological order of graph i at order[vertexOffsets[i] ...] (-1s if cyclic)
+    vector<char> hasCycle;   // hasCycle[i] = 1 if graph i is not a DAG
+};
+
+// Per-thread scratch memory for one small graph at a time
+struct SmallGraphArena {
+    vector<int> offsets, adj, indegree;
+
+    // Kahn's algorithm on V vertices / m edges, writing the order to out[0 .. V).
+    // Returns the number of vertices placed (< V means a cycle).
+    int kahn(int V, const pair<int, int>* e, int m, int* out) {
+        if ((int)offsets.size() < V + 1) offsets.resize(V + 1);
+        if ((int)indegree.size() < V) indegree.resize(V);
+        if ((int)adj.size() < m) adj.resize(m);
+
+        // CSR by counting sort (same neighbor order as the edge list)
+        fill(offsets.begin(), offsets.begin() + V + 1, 0);
+        fill(indegree.begin(), indegree.begin() + V, 0);
+        for (int i = 0; i < m; i++) {
+            offsets[e[i].first + 1]++;
+            indegree[e[i].second]++;
+        }
+        for (int u = 0; u < V; u++) offsets[u + 1] += offsets[u];
+        for (int i = 0; i < m; i++) adj[offsets[e[i].first]++] = e[i].second;
+        for (int u = V; u > 0; u--) offsets[u] = offsets[u - 1];   // Undo the shift of the fill pass
+        offsets[0] = 0;
+
+        int head = 0, tail = 0;
+        for (int v = 0; v < V; v++) {
+            if (indegree[v] == 0) out[tail++] = v;
+        }
+        while (head < tail) {
+            int u = out[head++];
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                if (--indegree[adj[k]] == 0) out[tail++] = adj[k];
+            }
+        }
+        return tail;
+    }
+};
+
+// Runs whole batches on a thread pool; the arenas stay alive between batches
+class BatchTopoSorter {
+public:
+    explicit BatchTopoSorter(ThreadPool& pool) : pool(pool), arenas(pool.size()), scratch(pool.size()) {}
+
+    // Topological order + cycle flag for every graph of the batch
+    void topoSort(const GraphBatch& batch, BatchTopoResult& res) {
+        res.order.resize(batch.totalVertices());
+        res.hasCycle.resize(batch.size());
+        forEachGraph(batch, [&](int tid, int i) {
+            int V = batch.numVertices(i);
+            int* out = res.order.data() + batch.vertexOffsets[i];
+            bool cyclic = runKahn(tid, batch, i, out) < V;
+            if (cyclic) fill(out, out + V, -1);
+            res.hasCycle[i] = cyclic;
+        });
+    }
+
+    // Cycle check only (the order goes to a per-thread buffer that is thrown away)
+    void hasCycle(const GraphBatch& batch, vector<char>& cyclic) {
+        cyclic.resize(batch.size());
+        forEachGraph(batch, [&](int tid, int i) {
+            int V = batch.numVertices(i);
+            if ((int)scratch[tid].size() < V) scratch[tid].resize(V);
+            cyclic[i] = runKahn(tid, batch, i, scratch[tid].data()) < V;
+        });
+    }
+
+private:
+    int runKahn(int tid, const GraphBatch& batch, int i, int* out) {
+        long long first = batch.edgeOffsets[i];
+        return arenas[tid].kahn(batch.numVertices(i), batch.edges.data() + first,
+                                (int)(batch.edgeOffsets[i + 1] - first), out);
+    }
+
+    // Graphs are handed out in chunks (dynamic load balancing: graph sizes vary)
+    template <typename Job>
+    void forEachGraph(const GraphBatch& batch, Job job) {
+        work.reset(batch.size(), 64);
+        pool.run([&](int tid) {
+            long long begin, end;
+            while (work.grab(begin, end)) {
+                for (long long i = begin; i < end; i++) job(tid, (int)i);
+            }
+        });
+    }
+
+    ThreadPool& pool;
+    vector<SmallGraphArena> arenas;   // One per thread
+    vector<vector<int>> scratch;      // Throw-away order buffer per thread (hasCycle)
+    ChunkQueue work;
+};
+
+
+// ⏱ Time Complexity (TC):
+// O(V + E) per graph, O(total V + total E) per batch, divided among the threads
+
+// 🧠 Space Complexity (SC):
+// Batch + results → O(total V + total E); arenas → O(T * (largest V + largest E))
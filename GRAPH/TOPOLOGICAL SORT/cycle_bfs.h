@@ -0,0 +1,49 @@
+// 📚 BFS cycle detection for undirected graphs on the shared CSR graph
+// (explained in 5-cycle-detect-UG(BFS).cpp).
+// Kept in a header so other programs (benchmarks) call the very same code.
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include "../CORE/csr_graph.h"
+using namespace std;
+
+// Detect a cycle in an undirected CSR (or compressed) graph (both directions stored) using BFS + parent tracking
+template <typename Graph>
+bool hasUndirectedCycleBFS(const Graph& g) {
+    int V = g.V;
+    vector<bool> visited(V, false);  // Track visited nodes
+
+    // Check each connected component of the graph
+    for (int i = 0; i < V; i++) {
+        if (!visited[i]) {  // If node not visited yet
+            queue<pair<int, int>> q; // Queue stores pairs of (node, parent)
+            q.push({i, -1});          // Start BFS from node i with no parent
+            visited[i] = true;        // Mark node as visited
+
+            while (!q.empty()) {
+                int node = q.front().first;    // Current node
+                int parent = q.front().second; // Parent of current node
+                q.pop();
+
+                // Traverse all adjacent nodes
+                for (int neighbor : g.neighbors(node)) {
+                    if (!visited[neighbor]) {
+                        // If neighbor not visited, mark visited and add to queue
+                        visited[neighbor] = true;
+                        q.push({neighbor, node});
+                    }
+                    else if (neighbor != parent) {
+                        // If neighbor is visited and not parent, cycle detected
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    // If no cycle found after BFS on all components
+    return false;
+}
@@ -0,0 +1,166 @@
+// 📚 Dynamic topological order under edge insertions and deletions (Pearce–Kelly algorithm)
+// (explained and demonstrated in 8-Incremental-Topo-Order.cpp; used as an online cycle
+// detector with cycle witnesses in 9-Online-Cycle-Detection.cpp)
+// Keeps ord[v] = position of v in a valid topological order while edges are added / removed one at a time.
+// An edge u -> v that already agrees with the order (ord[u] < ord[v]) costs O(1).
+// Otherwise only the vertices with positions between ord[v] and ord[u] can be affected:
+//   deltaF = vertices reachable from v with ord <= ord[u]   (reaching u itself → cycle)
+//   deltaB = vertices that reach u with ord >= ord[v]
+// and just those vertices are renumbered, reusing their own positions: all of deltaB first,
+// then all of deltaF, each group keeping its old relative order.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+class DynamicTopoOrder {
+public:
+    explicit DynamicTopoOrder(int V)
+        : out(V), in(V), ord(V), at(V), mark(V, 0), parent(V, -1) {
+        // No edges yet → any order is valid, start with 0, 1, 2, ...
+        for (int v = 0; v < V; v++) ord[v] = at[v] = v;
+    }
+
+    int numVertices() const { return (int)ord.size(); }
+
+    // O(1) queries
+    int position(int v) const { return ord[v]; }    // Index of v in the current order
+    int vertexAt(int i) const { return at[i]; }     // Vertex at index i
+    bool before(int u, int v) const { return ord[u] < ord[v]; }
+    const vector<int>& order() const { return at; }
+
+    // Add the edge u -> v and repair the order. If the edge would close a cycle it is NOT added,
+    // false is returned and `cycle` gets the cycle it would close: v -> ... -> u (then u -> v).
+    bool addEdge(int u, int v, vector<int>* cycle = nullptr) {
+        if (u == v) {
+            if (cycle) *cycle = {u};
+            return false;
+        }
+
+        int lb = ord[v], ub = ord[u];
+        if (lb < ub) {
+            // Affected region: forward search from v (must not reach u), backward search from u
+            stamp++;
+            deltaF.clear();
+            if (!forward(v, u, ub)) {
+                if (cycle) {
+                    cycle->clear();
+                    for (int x = u; x != -1; x = parent[x]) cycle->push_back(x);
+                    reverse(cycle->begin(), cycle->end());
+                }
+                return false;
+            }
+            deltaB.clear();
+            backward(u, lb);
+            reorder();
+        }
+
+        out[u].push_back(v);
+        in[v].push_back(u);
+        return true;
+    }
+
+    // Remove one copy of the edge u -> v (returns false if it does not exist).
+    // Dropping a constraint never invalidates the order → O(deg(u) + deg(v)), no reordering.
+    bool removeEdge(int u, int v) {
+        auto it = find(out[u].begin(), out[u].end(), v);
+        if (it == out[u].end()) return false;
+        *it = out[u].back();
+        out[u].pop_back();
+
+        auto jt = find(in[v].begin(), in[v].end(), u);
+        *jt = in[v].back();
+        in[v].pop_back();
+        return true;
+    }
+
+    bool hasEdge(int u, int v) const {
+        return find(out[u].begin(), out[u].end(), v) != out[u].end();
+    }
+
+private:
+    // DFS over out-edges from start, only through vertices with ord <= ub. Returns false if it finds target.
+    bool forward(int start, int target, int ub) {
+        stack.clear();
+        stack.push_back(start);
+        mark[start] = stamp;
+        parent[start] = -1;
+        while (!stack.empty()) {
+            int x = stack.back();
+            stack.pop_back();
+            deltaF.push_back(x);
+            for (int y : out[x]) {
+                if (y == target) {
+                    parent[y] = x;
+                    return false;
+                }
+                if (mark[y] != stamp && ord[y] < ub) {
+                    mark[y] = stamp;
+                    parent[y] = x;
+                    stack.push_back(y);
+                }
+            }
+        }
+        return true;
+    }
+
+    // DFS over in-edges from start, only through vertices with ord > lb
+    void backward(int start, int lb) {
+        stack.clear();
+        stack.push_back(start);
+        mark[start] = stamp;
+        while (!stack.empty()) {
+            int x = stack.back();
+            stack.pop_back();
+            deltaB.push_back(x);
+            for (int y : in[x]) {
+                if (mark[y] != stamp && ord[y] > lb) {
+                    mark[y] = stamp;
+                    stack.push_back(y);
+                }
+            }
+        }
+    }
+
+    // Give deltaB the smallest of the freed positions, then deltaF (relative orders preserved)
+    void reorder() {
+        auto byOrd = [&](int a, int b) { return ord[a] < ord[b]; };
+        sort(deltaB.begin(), deltaB.end(), byOrd);
+        sort(deltaF.begin(), deltaF.end(), byOrd);
+
+        slots.clear();
+        for (int x : deltaB) slots.push_back(ord[x]);
+        for (int x : deltaF) slots.push_back(ord[x]);
+        sort(slots.begin(), slots.end());
+
+        size_t i = 0;
+        for (int x : deltaB) place(x, slots[i++]);
+        for (int x : deltaF) place(x, slots[i++]);
+    }
+
+    void place(int x, int pos) {
+        ord[x] = pos;
+        at[pos] = x;
+    }
+
+    vector<vector<int>> out, in;   // Edges change one at a time, so plain adjacency lists (not CSR)
+    vector<int> ord, at;           // ord[v] = position, at[position] = v
+
+    // Search scratch, reused by every insertion: mark[v] == stamp means "seen in this search"
+    vector<int> mark, parent;
+    int stamp = 0;
+    vector<int> stack, deltaF, deltaB, slots;
+};
+
+
+// ⏱ Time Complexity (TC):
+// Query → O(1)
+// removeEdge → O(deg(u) + deg(v))
+// addEdge → O(1) if the edge agrees with the order, otherwise
+//           O(|affected edges| + |affected vertices| log |affected vertices|), where "affected"
+//           only covers vertices whose position lies between ord[v] and ord[u]
+
+// 🧠 Space Complexity (SC):
+// Adjacency lists (both directions) → O(V + E), order + scratch arrays → O(V)
@@ -0,0 +1,195 @@
+// 📚 Kahn's algorithm on the shared CSR graph
+// (explained in 2-Using-Kahn's-Algo(BFS).cpp and 4-Cycle_detect-DG(BFS).cpp).
+// Kept in a header so other programs (benchmarks) call the very same code.
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <atomic>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+using namespace std;
+
+// Topological Sort using Kahn's Algorithm (BFS) on a CSR (or compressed) graph
+// Returns an empty order if the graph has a cycle
+template <typename Graph>
+vector<int> kahnTopoSort(const Graph& g) {
+    int V = g.V;
+    vector<int> indegree(V, 0);       // Array to store in-degrees of all vertices
+
+    // Compute in-degrees from every neighbor list
+    for (int u = 0; u < V; u++) {
+        for (int v : g.neighbors(u)) {
+            indegree[v]++;            // Increment in-degree of destination vertex
+        }
+    }
+
+    queue<int> q;                     // Queue to store vertices with in-degree 0
+    vector<int> result;              // Vector to store topological order
+
+    // Push all vertices with in-degree 0 into the queue
+    for (int i = 0; i < V; ++i) {
+        if (indegree[i] == 0)
+            q.push(i);
+    }
+
+    // Process nodes with in-degree 0 and reduce in-degrees of neighbors
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        result.push_back(node);       // Add current node to topological order
+
+        // Reduce the in-degree of all adjacent vertices
+        for (int neighbor : g.neighbors(node)) {
+            indegree[neighbor]--;
+            if (indegree[neighbor] == 0) {
+                q.push(neighbor);     // If in-degree becomes 0, add to queue
+            }
+        }
+    }
+
+    // If result contains all vertices, a valid topological sort exists
+    if ((int)result.size() != V) {
+        return {};                    // Cycle: some nodes never reached in-degree 0
+    }
+
+    return result; // Return the topological sort order
+}
+
+// Detect a cycle using Kahn's Algorithm (BFS-based topological sort) on a CSR (or compressed) graph
+template <typename Graph>
+bool hasCycleKahn(const Graph& g) {
+    int V = g.V;
+    vector<int> indegree(V, 0);       // Array to store in-degrees of all vertices
+
+    // Calculate in-degrees from every neighbor list
+    for (int u = 0; u < V; u++) {
+        for (int v : g.neighbors(u)) {
+            indegree[v]++;            // Increase in-degree of destination node
+        }
+    }
+
+    queue<int> q;                     // Queue for nodes with in-degree 0
+    int count = 0;                    // Count of processed nodes
+
+    // Push all nodes with in-degree 0 to the queue
+    for (int i = 0; i < V; ++i) {
+        if (indegree[i] == 0)
+            q.push(i);
+    }
+
+    // Process the nodes using BFS
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        count++;                      // Increment count of processed nodes
+
+        // Decrease in-degree of all adjacent nodes
+        for (int neighbor : g.neighbors(node)) {
+            indegree[neighbor]--;
+            if (indegree[neighbor] == 0) {
+                q.push(neighbor);     // If in-degree becomes 0, add to queue
+            }
+        }
+    }
+
+    // If not all nodes were processed, a cycle exists
+    return count != V;
+}
+
+
+// 🧵 Parallel Kahn's algorithm (level-synchronous, see 7-Parallel-Kahn.cpp)
+// All vertices that are ready (in-degree 0) at the same time form one frontier. Threads split the
+// frontier, decrement in-degrees with atomic fetch_sub, and the thread that brings a vertex to 0
+// puts it in its own buffer. The buffers are merged (no lock) into the answer and form the next frontier.
+
+struct ParallelKahnResult {
+    vector<int> order;   // Valid topological order (only the vertices that became ready if there is a cycle)
+    vector<int> level;   // level[v] = length of the longest path ending at v (-1 if never ready)
+    int numLevels = 0;
+    bool hasCycle = false;   // Same rule as the serial version: some vertex never reached in-degree 0
+};
+
+inline ParallelKahnResult kahnTopoSortParallel(const CSRGraph& g, ThreadPool& pool) {
+    int V = g.V;
+    int T = pool.size();
+
+    ParallelKahnResult res;
+    res.order.resize(V);
+    res.level.assign(V, -1);
+    vector<atomic<int>> indegree(V);
+    for (int v = 0; v < V; v++) indegree[v].store(0, memory_order_relaxed);
+
+    // The answer array doubles as the frontier: the current level is order[levelBegin, levelEnd)
+    size_t levelBegin = 0, levelEnd = 0;
+    vector<vector<int>> local(T);   // Per-thread buffers of newly ready vertices
+    ChunkQueue work;
+    work.reset(V, 1024);
+    Barrier barrier(T);
+    int depth = 0;
+
+    pool.run([&](int tid) {
+        long long begin, end;
+
+        // Step 1: in-degrees, edges split across threads by source vertex
+        while (work.grab(begin, end)) {
+            for (long long u = begin; u < end; u++) {
+                for (int v : g.neighbors(u)) indegree[v].fetch_add(1, memory_order_relaxed);
+            }
+        }
+        barrier.wait();
+        if (tid == 0) work.reset(V, 1024);
+        barrier.wait();
+
+        // Step 2: vertices with in-degree 0 form level 0
+        local[tid].clear();
+        while (work.grab(begin, end)) {
+            for (long long u = begin; u < end; u++) {
+                if (indegree[u].load(memory_order_relaxed) == 0) local[tid].push_back(u);
+            }
+        }
+
+        while (true) {
+            barrier.wait();
+
+            // Merge the buffers behind the current level, lock-free (each thread owns a slice)
+            size_t offset = levelEnd + mergeOffset(local, tid);
+            for (size_t i = 0; i < local[tid].size(); i++) {
+                res.order[offset + i] = local[tid][i];
+                res.level[local[tid][i]] = depth;
+            }
+            barrier.wait();
+
+            if (tid == 0) {
+                levelBegin = levelEnd;
+                levelEnd += mergeSize(local);
+                work.reset(levelEnd - levelBegin, 64);
+            }
+            barrier.wait();
+            if (levelBegin == levelEnd) break;   // Nothing became ready → done
+
+            // Step 3: remove the current level, collect vertices whose in-degree drops to 0
+            local[tid].clear();
+            while (work.grab(begin, end)) {
+                for (long long i = begin; i < end; i++) {
+                    for (int v : g.neighbors(res.order[levelBegin + i])) {
+                        if (indegree[v].fetch_sub(1, memory_order_relaxed) == 1) local[tid].push_back(v);
+                    }
+                }
+            }
+            barrier.wait();
+            if (tid == 0) depth++;
+        }
+    });
+
+    res.numLevels = depth;
+    res.hasCycle = levelEnd != (size_t)V;
+    res.order.resize(levelEnd);
+    return res;
+}
+
+// Parallel cycle check: a cycle exists iff parallel Kahn's cannot remove every vertex
+inline bool hasCycleKahnParallel(const CSRGraph& g, ThreadPool& pool) {
+    return kahnTopoSortParallel(g, pool).hasCycle;
+}
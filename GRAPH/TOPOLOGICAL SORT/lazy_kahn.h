@@ -0,0 +1,172 @@
+// ⏯️ Lazy Kahn's algorithm: hand out vertices as soon as they become ready
+// (explained and benchmarked in 13-Lazy-Kahn-Pipeline.cpp)
+// kahnTopoSort returns the order only after the whole sort is done. LazyKahn instead keeps
+// Kahn's state (in-degrees + ready queue) and produces the order one vertex at a time:
+//   next(v)     → take a ready vertex (in-degree 0), amortized O(1)
+//   complete(v) → v is finished: its dependents lose one in-degree, newly ready ones are queued
+// A vertex is only released when the caller says its predecessor is COMPLETE, so a task executor
+// can dispatch task v, run it, and report completion whenever that happens.
+// for (int v : LazyKahn<CSRGraph>(g)) ... → plain lazy topological order (each vertex is completed
+// when the loop moves past it), the same order as kahnTopoSort.
+
+// 🧠 The initial zero-in-degree vertices are not collected up front: a scan pointer walks the ids
+// and stops at the next one, so the first next() costs O(1) once the in-degrees are known.
+// In-degrees are one O(V + E) counting pass, or skipped if the caller already keeps them
+// (e.g. maintained while the graph was built) and passes them to the constructor.
+
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include "../CORE/csr_graph.h"
+using namespace std;
+
+template <typename Graph>
+class LazyKahn {
+public:
+    explicit LazyKahn(const Graph& g) : g(g), indegree(g.V, 0), state(g.V, WAITING) {
+        for (int u = 0; u < g.V; u++) {
+            for (int v : g.neighbors(u)) indegree[v]++;
+        }
+    }
+
+    // In-degrees already known: nothing is scanned here
+    LazyKahn(const Graph& g, vector<int> indegree) : g(g), indegree(move(indegree)), state(g.V, WAITING) {}
+
+    // Take the next ready vertex. Returns false if none is ready right now
+    // (everything done, or waiting for complete() calls, or the rest of the graph is a cycle).
+    bool next(int& v) {
+        // Initial sources first, in id order (same order as kahnTopoSort's first queue fill)
+        while (scan < g.V) {
+            int s = scan++;
+            if (indegree[s] == 0 && state[s] == WAITING) {
+                state[s] = RUNNING;
+                inFlight++;
+                v = s;
+                return true;
+            }
+        }
+        if (head == ready.size()) return false;
+        v = ready[head++];
+        state[v] = RUNNING;
+        inFlight++;
+        return true;
+    }
+
+    // v (handed out by next) has finished → release its dependents. Returns how many became ready.
+    int complete(int v) {
+        state[v] = DONE;
+        inFlight--;
+        completed++;
+        int released = 0;
+        for (int w : g.neighbors(v)) {
+            if (--indegree[w] == 0) {
+                state[w] = READY;
+                ready.push_back(w);
+                released++;
+            }
+        }
+        return released;
+    }
+
+    int numCompleted() const { return completed; }
+    int numInFlight() const { return inFlight; }
+    bool done() const { return completed == g.V; }
+
+    // Nothing ready, nothing running, not done → the remaining vertices are blocked by a cycle
+    bool stuck() const {
+        return !done() && inFlight == 0 && head == ready.size() && !hasUnscannedSource();
+    }
+
+    // 🔁 Input iterator: yields the vertices in Kahn's order, completing each one when advanced
+    class iterator {
+    public:
+        iterator(LazyKahn* kahn) : kahn(kahn) { advance(); }
+        int operator*() const { return current; }
+        iterator& operator++() {
+            kahn->complete(current);
+            advance();
+            return *this;
+        }
+        bool operator!=(const iterator& other) const { return kahn != other.kahn; }
+
+    private:
+        void advance() {
+            if (kahn && !kahn->next(current)) kahn = nullptr;   // Exhausted (or cycle) → equals end()
+        }
+        LazyKahn* kahn;
+        int current = -1;
+    };
+
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(nullptr); }
+
+private:
+    enum : char { WAITING, READY, RUNNING, DONE };
+
+    bool hasUnscannedSource() const {
+        for (int s = scan; s < g.V; s++) {
+            if (indegree[s] == 0 && state[s] == WAITING) return true;
+        }
+        return false;
+    }
+
+    const Graph& g;
+    vector<int> indegree;
+    vector<char> state;
+    vector<int> ready;          // Released vertices, handed out FIFO from ready[head]
+    size_t head = 0;
+    int scan = 0;               // Next id to check for an initial source
+    int inFlight = 0, completed = 0;
+};
+
+// 🧵 Thread-safe front end for a pool of workers:
+// acquire() blocks until a task is ready (or returns false when there is nothing left to do),
+// complete() releases the dependents and wakes up waiting workers.
+template <typename Graph>
+class SharedTopoScheduler {
+public:
+    explicit SharedTopoScheduler(const Graph& g) : kahn(g) {}
+    SharedTopoScheduler(const Graph& g, vector<int> indegree) : kahn(g, move(indegree)) {}
+
+    bool acquire(int& v) {
+        unique_lock<mutex> lock(m);
+        while (true) {
+            if (kahn.next(v)) return true;
+            if (kahn.done() || kahn.numInFlight() == 0) {   // Finished, or a cycle blocks the rest
+                cv.notify_all();
+                return false;
+            }
+            cv.wait(lock);                                  // Some running task may release more
+        }
+    }
+
+    void complete(int v) {
+        bool wake;
+        {
+            lock_guard<mutex> lock(m);
+            // Waiters only care about new ready tasks, or about the last running task finishing
+            wake = kahn.complete(v) > 0 || kahn.numInFlight() == 0;
+        }
+        if (wake) cv.notify_all();
+    }
+
+    bool done() {
+        lock_guard<mutex> lock(m);
+        return kahn.done();
+    }
+
+private:
+    LazyKahn<Graph> kahn;
+    mutex m;
+    condition_variable cv;
+};
+
+
+// ⏱ Time Complexity (TC):
+// Construction → O(V + E) to count in-degrees (with precomputed in-degrees only the O(V) state array)
+// next() → amortized O(1), complete(v) → O(out-degree of v); whole run → O(V + E)
+
+// 🧠 Space Complexity (SC):
+// O(V): in-degrees, states and the ready queue
@@ -0,0 +1,243 @@
+// 🎯 Reachability index for DAGs: "can u reach v?" without a fresh BFS per query
+// (explained and benchmarked in 12-Reachability-Index.cpp)
+// Every label below is a NECESSARY condition for u ⇝ v, so a failed check is a definite "no":
+//   pos[u] < pos[v]       → topological position (edges only go forward in the order)
+//   level[u] < level[v]   → longest path from a source (every edge goes at least one level deeper)
+//   interval(v) ⊆ interval(u), for k GRAIL labels: a randomized DFS gives post[v] (post-order rank)
+//                           and low[v] = smallest post-order rank in everything v reaches,
+//                           interval(v) = [low[v], post[v]]. If u reaches v, everything v reaches
+//                           is reached by u too, so low[u] ≤ low[v] and post[v] ≤ post[u].
+// Small DAGs (V ≤ closureLimit): the full transitive closure as one bitset row per vertex
+// (64 targets per word) answers every query exactly with one bit test.
+// Otherwise: labels first; only if all of them say "maybe", a DFS from u that skips every vertex
+// whose labels already exclude v (pruned DFS).
+
+// 🧵 Parallel build: Kahn levels come from kahnTopoSortParallel, the k GRAIL labels are built by
+// different threads, and closure rows are filled level by level from the sinks up (all vertices
+// of one level are independent: their children sit on deeper, already finished levels).
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "../CORE/csr_graph.h"
+#include "../CORE/parallel.h"
+#include "../CORE/dfs_engine.h"   // DFSFrame
+#include "kahn.h"
+using namespace std;
+
+// Scratch memory for the pruned DFS (one per querying thread)
+struct ReachWorkspace {
+    vector<int> seen;    // seen[v] == stamp → visited in the current query
+    vector<int> stack;
+    int stamp = 0;
+
+    void prepare(int V) {
+        if ((int)seen.size() < V) seen.assign(V, 0);
+        if (++stamp == 0) {               // Stamp wrapped around → clear once
+            fill(seen.begin(), seen.end(), 0);
+            stamp = 1;
+        }
+        stack.clear();
+    }
+};
+
+class DAGReachability {
+public:
+    int numLabels;        // k GRAIL interval labels
+    int closureLimit;     // Build the bitset closure if V ≤ closureLimit
+
+    explicit DAGReachability(int numLabels = 3, int closureLimit = 8192)
+        : numLabels(numLabels), closureLimit(closureLimit) {}
+
+    // Build the index for g (g must stay alive while the index is used).
+    // Returns false if g has a cycle: the index is then left empty (built() == false).
+    bool build(const CSRGraph& g, ThreadPool& pool) {
+        clear();
+        ParallelKahnResult kahn = kahnTopoSortParallel(g, pool);
+        if (kahn.hasCycle) return false;
+
+        graph = &g;
+        V = g.V;
+        pos.resize(V);
+        for (int i = 0; i < V; i++) pos[kahn.order[i]] = i;
+        level = kahn.level;
+
+        buildIntervals(kahn.order, pool);
+        closure.clear();
+        words = (V + 63) / 64;
+        if (V <= closureLimit) buildClosure(kahn, pool);
+        return true;
+    }
+
+    // Back to the empty state: no graph, every query answers false
+    void clear() {
+        graph = nullptr;
+        V = words = 0;
+        pos.clear();
+        level.clear();
+        lo.clear();
+        hi.clear();
+        closure.clear();
+    }
+
+    bool built() const { return graph != nullptr; }
+    bool hasClosure() const { return !closure.empty(); }
+
+    // False → u definitely cannot reach v (or the index is not built). True → maybe (or yes).
+    bool mayReach(int u, int v) const {
+        if (!built()) return false;
+        if (pos[u] >= pos[v] || level[u] >= level[v]) return false;
+        const int* lu = lo.data() + (size_t)u * numLabels;
+        const int* hu = hi.data() + (size_t)u * numLabels;
+        const int* lv = lo.data() + (size_t)v * numLabels;
+        const int* hv = hi.data() + (size_t)v * numLabels;
+        for (int i = 0; i < numLabels; i++) {
+            if (lv[i] < lu[i] || hv[i] > hu[i]) return false;
+        }
+        return true;
+    }
+
+    // Exact answer; thread-safe as long as every thread passes its own workspace
+    bool reaches(int u, int v, ReachWorkspace& ws) const {
+        if (!built()) return false;
+        if (u == v) return true;
+        if (hasClosure()) return (closure[(size_t)u * words + (v >> 6)] >> (v & 63)) & 1;
+        if (!mayReach(u, v)) return false;
+
+        // Pruned DFS: only enter vertices that may still reach v
+        ws.prepare(V);
+        ws.stack.push_back(u);
+        ws.seen[u] = ws.stamp;
+        while (!ws.stack.empty()) {
+            int x = ws.stack.back();
+            ws.stack.pop_back();
+            for (int w : graph->neighbors(x)) {
+                if (w == v) return true;
+                if (ws.seen[w] == ws.stamp) continue;
+                ws.seen[w] = ws.stamp;
+                if (mayReach(w, v)) ws.stack.push_back(w);
+            }
+        }
+        return false;
+    }
+
+    // Single-threaded convenience version (uses the index's own workspace)
+    bool reaches(int u, int v) { return reaches(u, v, ownWorkspace); }
+
+    size_t memoryBytes() const {
+        return (pos.size() + level.size() + lo.size() + hi.size()) * sizeof(int) + closure.size() * sizeof(uint64_t);
+    }
+
+private:
+    // k randomized DFS post-orders + low values
+    void buildIntervals(const vector<int>& topoOrder, ThreadPool& pool) {
+        lo.assign((size_t)V * numLabels, 0);
+        hi.assign((size_t)V * numLabels, 0);
+        ChunkQueue work;
+        work.reset(numLabels, 1);
+
+        pool.run([&](int) {
+            vector<char> visited;
+            vector<DFSFrame> stack(V);   // Here edge = number of edges of v tried so far
+            vector<int> start(V);
+            long long begin, end;
+            while (work.grab(begin, end)) {
+                int label = (int)begin;
+                uint32_t seed = 0x9E3779B9u * (label + 1);
+                visited.assign(V, 0);
+                int post = 0;
+
+                // DFS with a different (pseudo-random) root order and child order per label:
+                // the roots are scanned from a label-specific offset, and vertex x starts at
+                // a hashed edge index in [0, degree) and wraps around
+                for (int r = 0; r < V; r++) {
+                    int root = (int)(((uint64_t)r + seed) % V);
+                    if (visited[root]) continue;
+                    visited[root] = 1;
+                    int top = 0;
+                    stack[top++] = {root, 0};
+                    start[root] = rotation(root, seed);
+                    while (top > 0) {
+                        DFSFrame& f = stack[top - 1];
+                        int deg = graph->offsets[f.v + 1] - graph->offsets[f.v];
+                        if (f.edge < deg) {
+                            int k = start[f.v] + f.edge++;   // < 2 * deg: no overflow
+                            if (k >= deg) k -= deg;
+                            int w = graph->adj[graph->offsets[f.v] + k];
+                            if (!visited[w]) {
+                                visited[w] = 1;
+                                start[w] = rotation(w, seed);
+                                stack[top++] = {w, 0};
+                            }
+                        } else {
+                            hi[(size_t)f.v * numLabels + label] = post++;
+                            top--;
+                        }
+                    }
+                }
+
+                // low[v] = min(post[v], low of every child): children come later in topological order
+                for (int i = V - 1; i >= 0; i--) {
+                    int v = topoOrder[i];
+                    int low = hi[(size_t)v * numLabels + label];
+                    for (int w : graph->neighbors(v)) low = min(low, lo[(size_t)w * numLabels + label]);
+                    lo[(size_t)v * numLabels + label] = low;
+                }
+            }
+        });
+    }
+
+    // Bitset transitive closure, deepest level first
+    void buildClosure(const ParallelKahnResult& kahn, ThreadPool& pool) {
+        closure.assign((size_t)V * words, 0);
+        // The parallel Kahn order is grouped by level: find where each level starts
+        vector<int> levelStart(kahn.numLevels + 1, 0);
+        for (int v = 0; v < V; v++) levelStart[level[v] + 1]++;
+        for (int l = 0; l < kahn.numLevels; l++) levelStart[l + 1] += levelStart[l];
+
+        ChunkQueue work;
+        for (int l = kahn.numLevels - 1; l >= 0; l--) {
+            work.reset(levelStart[l + 1] - levelStart[l], 16);
+            pool.run([&](int) {
+                long long begin, end;
+                while (work.grab(begin, end)) {
+                    for (long long i = begin; i < end; i++) {
+                        int u = kahn.order[levelStart[l] + i];
+                        uint64_t* row = closure.data() + (size_t)u * words;
+                        for (int w : graph->neighbors(u)) {
+                            const uint64_t* child = closure.data() + (size_t)w * words;
+                            for (int k = 0; k < words; k++) row[k] |= child[k];
+                            row[w >> 6] |= 1ULL << (w & 63);
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    // First edge index tried for v in one labeling: a hash of (v, seed) reduced to [0, degree)
+    int rotation(int v, uint32_t seed) const {
+        uint32_t deg = graph->offsets[v + 1] - graph->offsets[v];
+        if (deg == 0) return 0;
+        uint32_t x = ((uint32_t)v ^ seed) * 0x85EBCA6Bu;
+        return (int)((x ^ (x >> 13)) % deg);
+    }
+
+    const CSRGraph* graph = nullptr;
+    int V = 0, words = 0;
+    vector<int> pos, level;       // Topological position, Kahn level
+    vector<int> lo, hi;           // GRAIL intervals, numLabels per vertex (v * numLabels + label)
+    vector<uint64_t> closure;     // words bitset words per vertex (small DAGs only)
+    ReachWorkspace ownWorkspace;
+};
+
+
+// ⏱ Time Complexity (TC):
+// Build → O(k (V + E)) for the labels (+ O(E * V / 64) for the bitset closure of a small DAG)
+// Query → O(1) with the closure or when a label says "no";
+//         otherwise a pruned DFS, O(V + E) in the worst case but usually a tiny part of the graph
+
+// 🧠 Space Complexity (SC):
+// O((k + 2) V) labels, O(V² / 64) words for the closure (small DAGs only)
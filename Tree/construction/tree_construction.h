@@ -0,0 +1,147 @@
+// 🌳 Tree construction from traversals, shared by the two example programs and the benchmark.
+// Both builders recurse once per tree level, so a skewed (path-like) tree of n nodes
+// needs n stack frames.
+
+#pragma once
+
+#include <vector>
+#include <map>
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Build a binary tree from preorder + inorder (see TreeFomPreAndInorder.cpp)
+class TreeFromPreIn {
+public:
+    // Function to build a binary tree
+    // from preorder and inorder traversals
+    TreeNode* buildTree(vector<int>& preorder, vector<int>& inorder){
+        // Create a map to store indices
+        // of elements in the inorder traversal
+        map<int, int> inMap;
+        
+        // Populate the map with indices
+        // of elements in the inorder traversal
+        for(int i = 0; i < (int)inorder.size(); i++){
+            inMap[inorder[i]] = i;
+        }
+        
+        // Call the private helper function
+        // to recursively build the tree
+        TreeNode* root = buildTree(preorder, 0, preorder.size()-1, inorder, 0, inorder.size()-1, inMap);
+        
+        return root;
+    }
+
+private:
+    // Recursive helper function to build the tree
+    TreeNode* buildTree(vector<int>& preorder, int preStart, int preEnd, 
+            vector<int>& inorder, int inStart, int inEnd, map<int, int>& inMap){
+                // Base case: If the start indices 
+                // exceed the end indices, return NULL
+                if(preStart > preEnd || inStart > inEnd){
+                    return NULL;
+                }
+                
+                // Create a new TreeNode with value
+                // at the current preorder index
+                TreeNode* root = new TreeNode(preorder[preStart]);
+                
+                // Find the index of the current root
+                // value in the inorder traversal
+                int inRoot = inMap[root->val];
+                
+                // Calculate the number of
+                // elements in the left subtree
+                int numsLeft = inRoot - inStart;
+                
+                // Recursively build the left subtree
+                root->left = buildTree(preorder, preStart + 1, preStart + numsLeft, 
+                                inorder, inStart, inRoot - 1, inMap);
+                
+                // Recursively build the right subtree
+                root->right = buildTree(preorder, preStart + numsLeft + 1, preEnd, 
+                                inorder, inRoot + 1, inEnd, inMap);
+                
+                // Return the current root node
+                return root;
+            }
+};
+
+// Build a binary tree from inorder + postorder (see TreeFromPostAndInorder.cpp)
+class TreeFromPostIn {
+public:
+    // Function to build a binary tree
+    // from inorder and postorder traversals
+    TreeNode* buildTree(vector<int>& inorder, vector<int>& postorder) {
+        if (inorder.size() != postorder.size()) {
+            return NULL;
+        }
+
+        // Create a map to store the indices
+        // of elements in the inorder traversal
+        map<int, int> hm;
+        for (int i = 0; i < (int)inorder.size(); i++) {
+            hm[inorder[i]] = i;
+        }
+
+        // Call the recursive function
+        // to build the binary tree
+        return buildTreePostIn(inorder, 0, inorder.size() - 1, postorder, 0,
+            postorder.size() - 1, hm);
+    }
+
+    // Recursive function to build a binary
+    // tree from inorder and postorder traversals
+    TreeNode* buildTreePostIn(vector<int>& inorder, int is, int ie,
+        vector<int>& postorder, int ps, int pe, map<int, int>& hm) {
+
+        // Base case: If the subtree
+        // is empty, return NULL
+        if (ps > pe || is > ie) {
+            return NULL;
+        }
+
+        // Create a new TreeNode
+        // with the root value from postorder
+        TreeNode* root = new TreeNode(postorder[pe]);
+
+        // Find the index of the root
+        // value in inorder traversal
+        int inRoot = hm[postorder[pe]];
+        
+        // Number of nodes in the left subtree
+        int numsLeft = inRoot - is; 
+
+        // Recursively build the
+        // left and right subtrees
+        root->left = buildTreePostIn(inorder, is, inRoot - 1, postorder,
+            ps, ps + numsLeft - 1, hm);
+
+        root->right = buildTreePostIn(inorder, inRoot + 1, ie, postorder,
+            ps + numsLeft, pe - 1, hm);
+
+        // Return the root of
+        // the constructed subtree
+        return root;
+    }
+};
+
+// Free every node of a tree (iterative, so deep / skewed trees are fine)
+inline void deleteTree(TreeNode* root) {
+    vector<TreeNode*> stack;
+    if (root) stack.push_back(root);
+    while (!stack.empty()) {
+        TreeNode* node = stack.back();
+        stack.pop_back();
+        if (node->left) stack.push_back(node->left);
+        if (node->right) stack.push_back(node->right);
+        delete node;
+    }
+}